@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2020, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Parse-phase benchmark. Tiles an ISPD-style DEF and guide file n x n times
+// into a synthetic design, then times readLefDef and readGuide on it and
+// compares the block's hashed name indices with std::map lookups of the
+// same names.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include "frDesign.h"
+#include "global.h"
+#include "io/io.h"
+
+using namespace std;
+using namespace fr;
+
+namespace {
+  double getSeconds(chrono::steady_clock::time_point t0) {
+    return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+  }
+
+  string getTileName(const string &name, int tile) {
+    return "t" + to_string(tile) + "_" + name;
+  }
+
+  // renames every "( inst pin )" connection of a NETS line to tile
+  string tileConns(const string &line, int tile) {
+    stringstream ss(line);
+    string token, out;
+    bool isInst = false;
+    while (ss >> token) {
+      if (isInst && token != "PIN") {
+        token = getTileName(token, tile);
+      }
+      isInst = (token == "(");
+      out += (out.empty() ? "" : " ") + token;
+    }
+    return out;
+  }
+
+  // Copies the header, VIAS and tracks of the DEF and repeats COMPONENTS and
+  // NETS once per tile, shifted by the die size. Rows, pins, blockages and
+  // special nets are dropped. Expects the one-statement-per-line component
+  // format of the ISPD benchmarks.
+  bool tileDef(const string &inFile, const string &outFile, int numTiles, int &dieX, int &dieY) {
+    ifstream fin(inFile);
+    ofstream fout(outFile);
+    if (!fin.is_open() || !fout.is_open()) {
+      return false;
+    }
+    vector<string> comps, nets;
+    string line, section;
+    while (getline(fin, line)) {
+      stringstream ss(line);
+      string key;
+      ss >> key;
+      if (key == "END") {
+        string name;
+        ss >> name;
+        if (name == section) {
+          if (section == "VIAS") {
+            fout <<line <<"\n";
+          }
+          section = "";
+          continue;
+        }
+        if (name == "DESIGN") {
+          break;
+        }
+      }
+      if (section == "COMPONENTS") {
+        comps.push_back(line);
+      } else if (section == "NETS") {
+        nets.push_back(line);
+      } else if (section == "VIAS") {
+        fout <<line <<"\n";
+      } else if (section != "") {
+        continue;
+      } else if (key == "COMPONENTS" || key == "NETS" || key == "PINS" || key == "SPECIALNETS" ||
+                 key == "BLOCKAGES") {
+        section = key;
+      } else if (key == "VIAS") {
+        section = key;
+        fout <<line <<"\n";
+      } else if (key == "DIEAREA") {
+        string tmp;
+        int xl, yl;
+        ss >> tmp >> xl >> yl >> tmp >> tmp >> dieX >> dieY;
+        fout <<"DIEAREA ( 0 0 ) ( " <<(long long)dieX * numTiles <<" " <<(long long)dieY * numTiles <<" ) ;\n";
+      } else if (key == "TRACKS" || key == "GCELLGRID") {
+        string dir, tmp, rest;
+        int start, num;
+        ss >> dir >> start >> tmp >> num;
+        getline(ss, rest);
+        fout <<key <<" " <<dir <<" " <<start <<" DO " <<(long long)num * numTiles <<rest <<"\n";
+      } else if (key == "VERSION" || key == "DIVIDERCHAR" || key == "BUSBITCHARS" || key == "UNITS") {
+        fout <<line <<"\n";
+      } else if (key == "DESIGN") {
+        fout <<"DESIGN parseBench ;\n";
+      }
+    }
+
+    fout <<"COMPONENTS " <<(long long)comps.size() * numTiles * numTiles <<" ;\n";
+    for (int tx = 0; tx < numTiles; tx++) {
+      for (int ty = 0; ty < numTiles; ty++) {
+        int tile = tx * numTiles + ty;
+        for (auto &comp: comps) {
+          // - name macro [+ ...] + PLACED ( x y ) orient ;
+          stringstream ss(comp);
+          vector<string> tokens;
+          string token;
+          while (ss >> token) {
+            tokens.push_back(token);
+          }
+          if (tokens.size() < 2) {
+            continue;
+          }
+          tokens[1] = getTileName(tokens[1], tile);
+          for (int i = 0; i + 2 < (int)tokens.size(); i++) {
+            if (tokens[i] == "(") {
+              tokens[i + 1] = to_string(stoll(tokens[i + 1]) + (long long)tx * dieX);
+              tokens[i + 2] = to_string(stoll(tokens[i + 2]) + (long long)ty * dieY);
+            }
+          }
+          for (auto &str: tokens) {
+            fout <<str <<(&str == &tokens.back() ? "\n" : " ");
+          }
+        }
+      }
+    }
+    fout <<"END COMPONENTS\n\n";
+
+    long long numNets = 0;
+    for (auto &net: nets) {
+      numNets += (net.compare(0, 2, "- ") == 0);
+    }
+    fout <<"NETS " <<numNets * numTiles * numTiles <<" ;\n";
+    for (int tile = 0; tile < numTiles * numTiles; tile++) {
+      for (auto &net: nets) {
+        if (net.compare(0, 2, "- ") == 0) {
+          fout <<"- " <<getTileName(net.substr(2), tile) <<"\n";
+        } else {
+          fout <<"  " <<tileConns(net, tile) <<"\n";
+        }
+      }
+    }
+    fout <<"END NETS\n\nEND DESIGN\n";
+    return true;
+  }
+
+  // repeats every net block of the guide file once per tile, shifted like
+  // the components of its tile
+  bool tileGuide(const string &inFile, const string &outFile, int numTiles, int dieX, int dieY) {
+    ifstream fin(inFile);
+    ofstream fout(outFile);
+    if (!fin.is_open() || !fout.is_open()) {
+      return false;
+    }
+    vector<string> lines;
+    string line;
+    while (getline(fin, line)) {
+      lines.push_back(line);
+    }
+    for (int tx = 0; tx < numTiles; tx++) {
+      for (int ty = 0; ty < numTiles; ty++) {
+        int tile = tx * numTiles + ty;
+        bool isInNet = false;
+        for (auto &guide: lines) {
+          if (guide.empty()) {
+            continue;
+          } else if (guide == "(") {
+            isInNet = true;
+            fout <<guide <<"\n";
+          } else if (guide == ")") {
+            isInNet = false;
+            fout <<guide <<"\n";
+          } else if (isInNet) {
+            stringstream ss(guide);
+            long long xl, yl, xh, yh;
+            string layer;
+            ss >> xl >> yl >> xh >> yh >> layer;
+            fout <<xl + (long long)tx * dieX <<" " <<yl + (long long)ty * dieY <<" "
+                 <<xh + (long long)tx * dieX <<" " <<yh + (long long)ty * dieY <<" " <<layer <<"\n";
+          } else {
+            fout <<getTileName(guide, tile) <<"\n";
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  // finds every name once through lookup and returns the number of hits
+  template <typename T, typename Lookup>
+  size_t lookupAll(const vector<T*> &objs, Lookup lookup) {
+    size_t numHits = 0;
+    for (auto obj: objs) {
+      numHits += (lookup(obj->getName()) == obj);
+    }
+    return numHits;
+  }
+
+  // net connections and guides name their objects in no particular order, so
+  // the names are looked up shuffled
+  template <typename T, typename Lookup>
+  void compareLookups(const string &kind, const vector<unique_ptr<T> > &uObjs, Lookup lookup) {
+    vector<T*> objs;
+    for (auto &uObj: uObjs) {
+      objs.push_back(uObj.get());
+    }
+    shuffle(objs.begin(), objs.end(), mt19937(0));
+
+    auto t0 = chrono::steady_clock::now();
+    auto numHits = lookupAll(objs, lookup);
+    double hashTime = getSeconds(t0);
+
+    t0 = chrono::steady_clock::now();
+    map<string, T*> name2obj;
+    for (auto &uObj: uObjs) {
+      name2obj[uObj->getName()] = uObj.get();
+    }
+    double mapBuildTime = getSeconds(t0);
+    t0 = chrono::steady_clock::now();
+    auto numMapHits = lookupAll(objs, [&](const string &name) { return name2obj.find(name)->second; });
+    double mapTime = getSeconds(t0);
+
+    cout <<"lookup " <<kind <<": " <<objs.size() <<" names, hash index " <<hashTime <<"s, std::map "
+         <<mapTime <<"s (+" <<mapBuildTime <<"s to build)" <<endl;
+    if (numHits != objs.size() || numMapHits != objs.size()) {
+      cout <<"Error: " <<kind <<" lookup missed " <<objs.size() - numHits <<" names" <<endl;
+      exit(1);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 6) {
+    cout <<"Usage: parseBench <lef> <def> <guide> <tiles> <work_dir>" <<endl;
+    cout <<"       (e.g., parseBench ispd18_test1.input.{lef,def,guide} 15 /tmp/bench, 2M insts)" <<endl;
+    return 1;
+  }
+  int numTiles = atoi(argv[4]);
+  string workDir = argv[5];
+  mkdir(workDir.c_str(), 0755);
+  LEF_FILE   = argv[1];
+  DEF_FILE   = workDir + "/parseBench.def";
+  GUIDE_FILE = workDir + "/parseBench.guide";
+  VERBOSE    = 0;
+
+  auto t0 = chrono::steady_clock::now();
+  int dieX = 0, dieY = 0;
+  if (numTiles < 1 || !tileDef(argv[2], DEF_FILE, numTiles, dieX, dieY) ||
+      !tileGuide(argv[3], GUIDE_FILE, numTiles, dieX, dieY)) {
+    cout <<"Error: cannot generate the tiled design in " <<workDir <<endl;
+    return 1;
+  }
+  cout <<"generate " <<numTiles <<"x" <<numTiles <<" tiles: " <<getSeconds(t0) <<"s" <<endl;
+
+  auto design = make_unique<frDesign>();
+  io::Parser parser(design.get());
+  t0 = chrono::steady_clock::now();
+  parser.readLefDef();
+  double lefDefTime = getSeconds(t0);
+  t0 = chrono::steady_clock::now();
+  parser.readGuide();
+  double guideTime = getSeconds(t0);
+
+  auto block = design->getTopBlock();
+  cout <<"#insts:  " <<block->getInsts().size() <<endl;
+  cout <<"#nets:   " <<block->getNets().size()  <<endl;
+  cout <<"#guides: " <<parser.getGuides().size() <<endl;
+  cout <<"readLefDef: " <<lefDefTime <<"s" <<endl;
+  cout <<"readGuide:  " <<guideTime  <<"s" <<endl;
+
+  compareLookups("insts", block->getInsts(), [&](const string &name) { return block->getInst(name); });
+  compareLookups("nets",  block->getNets(),  [&](const string &name) { return block->getNet(name); });
+  return 0;
+}
@@ -30,28 +30,34 @@
 #define _TRITONROUTE_H_
 
 #include <memory>
+#include <vector>
 
 namespace fr {
   class frDesign;
+  class frNet;
+  class frRect;
+  class FlexRoute;
 }
 
 namespace triton_route {
+  // library entry point, see fr::FlexRoute for the stages
   class TritonRoute {
   public:
     TritonRoute();
-    fr::frDesign* getDesign() const {
-      return design.get();
-    }
+    // a design built in memory instead of read from LEF/DEF
+    TritonRoute(std::unique_ptr<fr::frDesign> design);
+    ~TritonRoute();
+    fr::frDesign* getDesign() const;
+    void setGuides(fr::frNet* net, const std::vector<fr::frRect> &rects);
     int main();
-  protected:
-    std::unique_ptr<fr::frDesign> design;
-  
     void init();
-    //void pinPrep();
     void prep();
     void ta();
     void dr();
     void endFR();
+    int eco();
+  protected:
+    std::unique_ptr<fr::FlexRoute> router;
   };
 }
 #endif
@@ -26,9 +26,12 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <iostream>
 #include "global.h"
 #include "FlexRoute.h"
+#include "db/infra/frMetrics.h"
+#include "db/infra/frHash.h"
 #include "io/io.h"
 #include "pa/FlexPA.h"
 #include "ta/FlexTA.h"
@@ -50,32 +53,180 @@ void FlexRoute::init() {
   }
 
   io::Parser parser(getDesign());
-  parser.readLefDef();
-  parser.readGuide();
-  parser.postProcess();
-  FlexPA pa(getDesign());
-  pa.main();
+  {
+    frMetrics metrics("read");
+    if (getDesign()->getTopBlock()) {
+      // built in memory, the raw guides come from setGuides
+      parser.getGuides().swap(guides);
+      guides.clear();
+    } else if (DESIGN_SNAPSHOT_FILE == "" || !parser.readSnapshot(DESIGN_SNAPSHOT_FILE)) {
+      // a valid snapshot replaces the DEF and guide parsing
+      parser.readLefDef();
+      parser.readGuide();
+      if (DESIGN_SNAPSHOT_FILE != "") {
+        parser.writeSnapshot(DESIGN_SNAPSHOT_FILE);
+      }
+    }
+    parser.postProcess();
+    metrics.add("insts", getDesign()->getTopBlock()->getInsts().size());
+    metrics.add("nets", getDesign()->getTopBlock()->getNets().size());
+  }
+  {
+    frMetrics metrics("pa");
+    FlexPA pa(getDesign());
+    pa.main();
+  }
+  frMetrics metrics("guide");
   parser.postProcessGuide();
 }
 
 void FlexRoute::prep() {
+  frMetrics metrics("rp");
   FlexRP rp(getDesign(), getDesign()->getTech());
   rp.main();
 }
 
 void FlexRoute::ta() {
-  FlexTA ta(getDesign());
-  ta.main();
+  {
+    frMetrics metrics("ta");
+    FlexTA ta(getDesign());
+    ta.main();
+  }
+  // worker processes of a distributed run leave the output to the leader
+  if (DR_DIST_LEADER != "") {
+    return;
+  }
+  frMetrics metrics("write_ta");
   io::Writer writer(getDesign());
   writer.writeFromTA();
 }
 
 void FlexRoute::dr() {
+  frMetrics metrics("dr");
+  FlexDR dr(getDesign());
+  dr.main();
+  metrics.add("markers", getDesign()->getTopBlock()->getNumMarkers());
+  savePinKeys();
+}
+
+// hash of the sorted pin names, instances that moved are not detected
+uint64_t FlexRoute::getPinKey(frNet* net) {
+  vector<string> names;
+  for (auto &instTerm: net->getInstTerms()) {
+    names.push_back(instTerm->getInst()->getName() + "/" + instTerm->getTerm()->getName());
+  }
+  for (auto &term: net->getTerms()) {
+    names.push_back("PIN/" + term->getName());
+  }
+  sort(names.begin(), names.end());
+  uint64_t key = frHashSeed;
+  for (auto &name: names) {
+    frHashString(key, name);
+  }
+  return key;
+}
+
+void FlexRoute::savePinKeys() {
+  auto &nets = getDesign()->getTopBlock()->getNets();
+  pinKeys.clear();
+  for (auto &net: nets) {
+    pinKeys[net.get()] = getPinKey(net.get());
+  }
+}
+
+int FlexRoute::eco() {
+  frMetrics metrics("eco");
+  auto block = getDesign()->getTopBlock();
+  auto rq = getDesign()->getRegionQuery();
+  set<frNet*, frBlockObjectComp> ecoNets;
+  // nets whose pins changed but got no new guides keep their raw guides
+  set<frNet*, frBlockObjectComp> keepGuides;
+  for (auto &net: block->getNets()) {
+    if (guides.find(net.get()) != guides.end()) {
+      ecoNets.insert(net.get());
+    } else if (auto it = pinKeys.find(net.get()); it == pinKeys.end() || it->second != getPinKey(net.get())) {
+      ecoNets.insert(net.get());
+      keepGuides.insert(net.get());
+    }
+  }
+  metrics.add("nets", ecoNets.size());
+  if (ecoNets.empty()) {
+    return 0;
+  }
+  if (VERBOSE > 0) {
+    cout <<endl <<"start eco of " <<ecoNets.size() <<" nets ..." <<endl;
+  }
+
+  if (!keepGuides.empty()) {
+    frBox dieBox;
+    block->getBoundaryBBox(dieBox);
+    for (frLayerNum i = 0; i < (int)getDesign()->getTech()->getLayers().size(); i++) {
+      frRegionQuery::Objects<frNet> result;
+      rq->queryOrigGuide(dieBox, i, result);
+      for (auto &[box, net]: result) {
+        if (keepGuides.find(net) != keepGuides.end()) {
+          frRect rect;
+          rect.setBBox(box);
+          rect.setLayerNum(i);
+          guides[net].push_back(rect);
+        }
+      }
+    }
+  }
+
+  // rip up the eco nets, the markers on them are found again by dr
+  for (auto net: ecoNets) {
+    for (auto it = net->getShapes().begin(); it != net->getShapes().end();) {
+      auto shape = (it++)->get();
+      rq->removeDRObj(shape);
+      net->removeShape(shape);
+    }
+    for (auto it = net->getVias().begin(); it != net->getVias().end();) {
+      auto via = (it++)->get();
+      rq->removeDRObj(via);
+      net->removeVia(via);
+    }
+    for (auto it = net->getPatchWires().begin(); it != net->getPatchWires().end();) {
+      auto pwire = (it++)->get();
+      rq->removeDRObj(pwire);
+      net->removePatchWire(pwire);
+    }
+  }
+  vector<frMarker*> markers;
+  for (auto &marker: block->getMarkers()) {
+    for (auto src: marker->getSrcs()) {
+      if (src->typeId() == frcNet && ecoNets.find(static_cast<frNet*>(src)) != ecoNets.end()) {
+        markers.push_back(marker.get());
+        break;
+      }
+    }
+  }
+  for (auto marker: markers) {
+    rq->removeMarker(marker);
+    block->removeMarker(marker);
+  }
+
+  {
+    io::Parser parser(getDesign());
+    parser.getGuides().swap(guides);
+    guides.clear();
+    parser.postProcessGuide_eco();
+  }
+  {
+    FlexTA ta(getDesign());
+    ta.setEcoNets(ecoNets);
+    ta.main();
+  }
   FlexDR dr(getDesign());
+  dr.setEcoNets(ecoNets);
   dr.main();
+  metrics.add("markers", block->getNumMarkers());
+  savePinKeys();
+  return ecoNets.size();
 }
 
 void FlexRoute::endFR() {
+  frMetrics metrics("write");
   io::Writer writer(getDesign());
   writer.writeFromDR();
 }
@@ -83,9 +234,14 @@ void FlexRoute::endFR() {
 int FlexRoute::main() {
   init();
   prep();
-  ta();
+  // a restarted run picks up the routes from the DR checkpoint instead
+  if (DR_RESTART_FILE == "") {
+    ta();
+  }
   dr();
-  endFR();
+  if (DR_DIST_LEADER == "") {
+    endFR();
+  }
 
   return 0;
 }
@@ -30,6 +30,7 @@
 #define _FLEXROUTE_H_
 
 #include <memory>
+#include <unordered_map>
 #include "frBaseTypes.h"
 #include "frDesign.h"
 
@@ -37,18 +38,36 @@ namespace fr {
   class FlexRoute {
   public:
     FlexRoute(): design(std::make_unique<frDesign>()) {}
+    // a design built in memory, init() skips the LEF/DEF read
+    FlexRoute(std::unique_ptr<frDesign> designIn): design(std::move(designIn)) {}
     frDesign* getDesign() const {
       return design.get();
     }
+    // raw guides of a net for the next init() or eco()
+    void setGuides(frNet* net, const std::vector<frRect> &rects) {
+      guides[net] = rects;
+    }
     int main();
-  protected:
-    std::unique_ptr<frDesign> design;
-  
+    // stages in the order main() runs them
     void init();
     void prep();
     void ta();
     void dr();
     void endFR();
+    // reroutes the nets whose pins or guides changed since the last dr() or
+    // eco() and keeps the routes of all other nets, returns the number of nets.
+    // PA is not rerun: an instTerm connected now must have been connected at
+    // prep(), and a moved instance is not detected
+    int eco();
+  protected:
+    std::unique_ptr<frDesign> design;
+    std::map<frNet*, std::vector<frRect>, frBlockObjectComp> guides;
+    // pin key of each net at the last dr() or eco(), by pointer since in-memory
+    // nets need not have dense ids
+    std::unordered_map<frNet*, uint64_t> pinKeys;
+
+    uint64_t getPinKey(frNet* net);
+    void savePinKeys();
   };
 }
 #endif
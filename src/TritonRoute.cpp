@@ -0,0 +1,76 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "triton_route/TritonRoute.h"
+#include "FlexRoute.h"
+
+using namespace std;
+using namespace fr;
+using namespace triton_route;
+
+TritonRoute::TritonRoute(): router(make_unique<FlexRoute>()) {}
+
+TritonRoute::TritonRoute(unique_ptr<frDesign> design): router(make_unique<FlexRoute>(std::move(design))) {}
+
+TritonRoute::~TritonRoute() = default;
+
+frDesign* TritonRoute::getDesign() const {
+  return router->getDesign();
+}
+
+void TritonRoute::setGuides(frNet* net, const vector<frRect> &rects) {
+  router->setGuides(net, rects);
+}
+
+int TritonRoute::main() {
+  return router->main();
+}
+
+void TritonRoute::init() {
+  router->init();
+}
+
+void TritonRoute::prep() {
+  router->prep();
+}
+
+void TritonRoute::ta() {
+  router->ta();
+}
+
+void TritonRoute::dr() {
+  router->dr();
+}
+
+void TritonRoute::endFR() {
+  router->endFR();
+}
+
+int TritonRoute::eco() {
+  return router->eco();
+}
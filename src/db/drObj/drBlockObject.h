@@ -31,15 +31,31 @@
 
 #include "frBaseTypes.h"
 #include "db/obj/frBlockObject.h"
+#include "db/infra/frArena.h"
 
 namespace fr {
   class drBlockObject: public frBlockObject {
   public:
     virtual ~drBlockObject() {}
+    // dr objects come from the arena set for the calling thread, see
+    // FlexDRWorker::main_mt
+    static void* operator new(std::size_t size) {
+      return frArena::allocate(arena, size);
+    }
+    static void operator delete(void* ptr) {
+      frArena::release(ptr);
+    }
+    // returns the previous arena of the calling thread
+    static frArena* setArena(frArena* in) {
+      auto prev = arena;
+      arena = in;
+      return prev;
+    }
     // getters
     // setters
     // others
   protected:
+    static inline thread_local frArena* arena = nullptr;
     // constructors
     drBlockObject() {}
   };
@@ -31,15 +31,33 @@
 
 #include "frBaseTypes.h"
 #include "db/obj/frBlockObject.h"
+#include "db/infra/frArena.h"
 
 namespace fr {
   class gcBlockObject: public frBlockObject {
   public:
     virtual ~gcBlockObject() {}
+    // gc objects come from the arena of the running FlexGCWorker
+    static void* operator new(std::size_t size) {
+      return frArena::allocate(arena, size);
+    }
+    static void operator delete(void* ptr) {
+      frArena::release(ptr);
+    }
+    // returns the previous arena of the calling thread
+    static frArena* setArena(frArena* in) {
+      auto prev = arena;
+      arena = in;
+      return prev;
+    }
+    static frArena* getArena() {
+      return arena;
+    }
     // getters
     // setters
     // others
   protected:
+    static inline thread_local frArena* arena = nullptr;
     // constructors
     gcBlockObject(): frBlockObject() {}
     gcBlockObject(const gcBlockObject &in): frBlockObject(in) {}
@@ -30,6 +30,7 @@
 #define _GC_NET_H_
 
 #include <memory>
+#include <set>
 #include "db/gcObj/gcBlockObject.h"
 #include "db/gcObj/gcPin.h"
 
@@ -39,7 +40,8 @@ namespace fr {
   public:
     // constructors
     gcNet(int numLayers): gcBlockObject(), fixedPolygons(numLayers), routePolygons(numLayers), 
-                          fixedRectangles(numLayers), routeRectangles(numLayers), pins(numLayers), owner(nullptr) {}
+                          fixedRectangles(numLayers), routeRectangles(numLayers), pins(numLayers), owner(nullptr),
+                          hasFixedCache(false), fixedPolygonEdges(), fixedMaxRectangles() {}
     // setters
     void addPolygon(const frBox &box, frLayerNum layerNum, bool isFixed = false) {
       gtl::rectangle_data<frCoord> rect(box.left(), box.bottom(), box.right(), box.top());
@@ -71,6 +73,15 @@ namespace fr {
       pin->setId(pins[layerNum].size());
       pins[layerNum].push_back(std::move(pin));
     }
+    void addPin(std::unique_ptr<gcPin> in, frLayerNum layerNum) {
+      in->setId(pins[layerNum].size());
+      pins[layerNum].push_back(std::move(in));
+    }
+    // moves the pins of one layer to out
+    void takePins(frLayerNum layerNum, std::vector<std::unique_ptr<gcPin> > &out) {
+      out.clear();
+      out.swap(pins[layerNum]);
+    }
     void setOwner(frBlockObject* in) {
       owner = in;
     }
@@ -80,6 +91,26 @@ namespace fr {
       routePolygons.resize(size);
       routeRectangles.clear();
       routeRectangles.resize(size);
+      clearPins();
+    }
+    // moves the route shapes to out, pins are kept
+    void takeRoute(std::vector<gtl::polygon_90_set_data<frCoord> > &outPolygons,
+                   std::vector<std::vector<gtl::rectangle_data<frCoord> > > &outRectangles) {
+      auto size = routePolygons.size();
+      outPolygons.swap(routePolygons);
+      routePolygons.clear();
+      routePolygons.resize(size);
+      outRectangles.swap(routeRectangles);
+      routeRectangles.clear();
+      routeRectangles.resize(size);
+    }
+    void setFixedCache(std::vector<std::set<std::pair<frPoint, frPoint> > > &edges,
+                       std::vector<std::set<std::pair<frPoint, frPoint> > > &maxRects) {
+      fixedPolygonEdges.swap(edges);
+      fixedMaxRectangles.swap(maxRects);
+      hasFixedCache = true;
+    }
+    void clearPins() {
       for (auto &layerPins: pins) {
         layerPins.clear();
       }
@@ -119,6 +150,15 @@ namespace fr {
     const std::vector<std::unique_ptr<gcPin> >& getPins(frLayerNum layerNum) const {
       return pins[layerNum];
     }
+    bool hasFixedShapeCache() const {
+      return hasFixedCache;
+    }
+    const std::vector<std::set<std::pair<frPoint, frPoint> > >& getFixedPolygonEdges() const {
+      return fixedPolygonEdges;
+    }
+    const std::vector<std::set<std::pair<frPoint, frPoint> > >& getFixedMaxRectangles() const {
+      return fixedMaxRectangles;
+    }
     bool hasOwner() const {
       return (owner);
     }
@@ -136,6 +176,10 @@ namespace fr {
     std::vector<std::vector<gtl::rectangle_data<frCoord> > > routeRectangles; // only cut layer
     std::vector<std::vector<std::unique_ptr<gcPin> > >       pins;
     frBlockObject*                                           owner;
+    // fixed shapes do not change, kept for incremental updates
+    bool                                                     hasFixedCache;
+    std::vector<std::set<std::pair<frPoint, frPoint> > >     fixedPolygonEdges;
+    std::vector<std::set<std::pair<frPoint, frPoint> > >     fixedMaxRectangles;
 
     void init();
   };
@@ -84,6 +84,37 @@ namespace fr {
     std::vector<std::vector<std::unique_ptr<gcCorner> > > polygon_corners;
     std::vector<std::unique_ptr<gcRect> > max_rectangles;
   };
+
+  inline gcCorner* gcCorner::getPrevCorner() const {
+    auto &corners = pin->getPolygonCorners()[ring];
+    return corners[pos == 0 ? corners.size() - 1 : pos - 1].get();
+  }
+  inline gcCorner* gcCorner::getNextCorner() const {
+    auto &corners = pin->getPolygonCorners()[ring];
+    return corners[pos + 1 == corners.size() ? 0 : pos + 1].get();
+  }
+  inline gcSegment* gcCorner::getPrevEdge() const {
+    auto &edges = pin->getPolygonEdges()[ring];
+    return edges[pos == 0 ? edges.size() - 1 : pos - 1].get();
+  }
+  inline gcSegment* gcCorner::getNextEdge() const {
+    return pin->getPolygonEdges()[ring][pos].get();
+  }
+  inline gcSegment* gcSegment::getPrevEdge() const {
+    auto &edges = pin->getPolygonEdges()[ring];
+    return edges[pos == 0 ? edges.size() - 1 : pos - 1].get();
+  }
+  inline gcSegment* gcSegment::getNextEdge() const {
+    auto &edges = pin->getPolygonEdges()[ring];
+    return edges[pos + 1 == edges.size() ? 0 : pos + 1].get();
+  }
+  inline gcCorner* gcSegment::getLowCorner() const {
+    return pin->getPolygonCorners()[ring][pos].get();
+  }
+  inline gcCorner* gcSegment::getHighCorner() const {
+    auto &corners = pin->getPolygonCorners()[ring];
+    return corners[pos + 1 == corners.size() ? 0 : pos + 1].get();
+  }
 }
 
 
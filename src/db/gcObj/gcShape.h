@@ -66,22 +66,20 @@ namespace fr {
   class gcCorner: public gtl::point_data<frCoord> {
   public:
     // constructors
-    gcCorner(): prevCorner(nullptr), nextCorner(nullptr), prevEdge(nullptr), nextEdge(nullptr), cornerType(frCornerTypeEnum::UNKNOWN), cornerDir(frCornerDirEnum::UNKNOWN), fixed(false) {}
+    gcCorner(): pin(nullptr), ring(0), pos(0), cornerType(frCornerTypeEnum::UNKNOWN), cornerDir(frCornerDirEnum::UNKNOWN), fixed(false) {}
     gcCorner(const gcCorner &in) = default;
-
-    // getters
-    gcCorner* getPrevCorner() const {
-      return prevCorner;
-    }
-    gcCorner* getNextCorner() const {
-      return nextCorner;
-    }
-    gcSegment* getPrevEdge() const {
-      return prevEdge;
+    static void* operator new(std::size_t size) {
+      return frArena::allocate(gcBlockObject::getArena(), size);
     }
-    gcSegment* getNextEdge() const {
-      return nextEdge;
+    static void operator delete(void* ptr) {
+      frArena::release(ptr);
     }
+
+    // getters, neighbours are found by position in the ring of the pin (gcPin.h)
+    gcCorner* getPrevCorner() const;
+    gcCorner* getNextCorner() const;
+    gcSegment* getPrevEdge() const;
+    gcSegment* getNextEdge() const;
     frCornerTypeEnum getType() const {
       return cornerType;
     }
@@ -93,17 +91,11 @@ namespace fr {
     }
 
     // setters
-    void setPrevCorner(gcCorner* in) {
-      prevCorner = in;
-    }
-    void setNextCorner(gcCorner* in) {
-      nextCorner = in;
-    }
-    void setPrevEdge(gcSegment* in) {
-      prevEdge = in;
-    }
-    void setNextEdge(gcSegment* in) {
-      nextEdge = in;
+    // corner pos of ring in pin sits between edges pos - 1 and pos
+    void setRing(gcPin* pinIn, int ringIn, int posIn) {
+      pin  = pinIn;
+      ring = ringIn;
+      pos  = posIn;
     }
     void setType(frCornerTypeEnum in) {
       cornerType = in;
@@ -116,10 +108,9 @@ namespace fr {
     }
 
   private:
-    gcCorner* prevCorner;
-    gcCorner* nextCorner;
-    gcSegment* prevEdge;
-    gcSegment* nextEdge;
+    gcPin*   pin;
+    uint32_t ring;
+    uint32_t pos;
     frCornerTypeEnum cornerType;
     frCornerDirEnum cornerDir; // points away from poly for convex and concave
     bool fixed;
@@ -128,24 +119,14 @@ namespace fr {
   class gcSegment: public gtl::segment_data<frCoord>, public gcShape {
   public:
     // constructors
-    gcSegment(): gtl::segment_data<frCoord>(), gcShape(), layer(-1), pin(nullptr), net(nullptr), prev_edge(nullptr),
-                                               next_edge(nullptr), lowCorner(nullptr), highCorner(nullptr), fixed(false) {}
+    gcSegment(): gtl::segment_data<frCoord>(), gcShape(), layer(-1), pin(nullptr), net(nullptr), ring(0), pos(0), fixed(false) {}
     gcSegment(const gcSegment &in): gtl::segment_data<frCoord>(in), gcShape(in), layer(in.layer), pin(in.pin), net(in.net),
-                              prev_edge(in.prev_edge), next_edge(in.next_edge),
-                              lowCorner(in.lowCorner), highCorner(in.highCorner), fixed(in.fixed) {}
-    // getters
-    gcSegment* getPrevEdge() const {
-      return prev_edge;
-    }
-    gcSegment* getNextEdge() const {
-      return next_edge;
-    }
-    gcCorner* getLowCorner() const {
-      return lowCorner;
-    }
-    gcCorner* getHighCorner() const {
-      return highCorner;
-    }
+                              ring(in.ring), pos(in.pos), fixed(in.fixed) {}
+    // getters, neighbours are found by position in the ring of the pin (gcPin.h)
+    gcSegment* getPrevEdge() const;
+    gcSegment* getNextEdge() const;
+    gcCorner* getLowCorner() const;
+    gcCorner* getHighCorner() const;
     bool isFixed() const {
       return fixed;
     }
@@ -177,17 +158,10 @@ namespace fr {
       gtl::segment_data<frCoord>::low(bp);
       gtl::segment_data<frCoord>::high(ep);
     }
-    void setPrevEdge(gcSegment* in) {
-      prev_edge = in;
-    }
-    void setNextEdge(gcSegment* in) {
-      next_edge = in;
-    }
-    void setLowCorner(gcCorner* in) {
-      lowCorner = in;
-    }
-    void setHighCorner(gcCorner* in) {
-      highCorner = in;
+    // edge pos of ring in pin runs from corner pos to corner pos + 1
+    void setRing(int ringIn, int posIn) {
+      ring = ringIn;
+      pos  = posIn;
     }
     void setFixed(bool in) {
       fixed = in;
@@ -254,10 +228,8 @@ namespace fr {
     frLayerNum  layer;
     gcPin*      pin;
     gcNet*      net;
-    gcSegment*  prev_edge;
-    gcSegment*  next_edge;
-    gcCorner*   lowCorner;
-    gcCorner*   highCorner;
+    uint32_t    ring;
+    uint32_t    pos;
     bool        fixed;
   };
 
@@ -0,0 +1,88 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <new>
+#include "db/infra/frArena.h"
+
+using namespace std;
+using namespace fr;
+
+frArena::~frArena() {
+  for (auto chunk: chunks) {
+    ::operator delete(chunk);
+  }
+}
+
+void* frArena::allocateBlock(size_t sizeClass) {
+  auto &freeList = freeLists[sizeClass];
+  if (freeList) {
+    auto block = freeList;
+    freeList = *static_cast<void**>(block);
+    return block;
+  }
+  size_t blockSize = (sizeClass + 1) * GRANULE;
+  if (currPos == nullptr || currPos + blockSize > currEnd) {
+    currPos = static_cast<char*>(::operator new(CHUNKSIZE));
+    currEnd = currPos + CHUNKSIZE;
+    chunks.push_back(currPos);
+    numBytes += CHUNKSIZE;
+  }
+  auto block = currPos;
+  currPos += blockSize;
+  return block;
+}
+
+void* frArena::allocate(frArena* arena, size_t size) {
+  // header plus size rounded up to GRANULE, minus one
+  size_t sizeClass = (size + sizeof(frArenaHeader) - 1) / GRANULE;
+  frArenaHeader* header = nullptr;
+  if (arena && sizeClass < NUMSIZECLASSES) {
+    header = static_cast<frArenaHeader*>(arena->allocateBlock(sizeClass));
+  } else {
+    header = static_cast<frArenaHeader*>(::operator new(size + sizeof(frArenaHeader)));
+    arena  = nullptr;
+  }
+  header->arena     = arena;
+  header->sizeClass = sizeClass;
+  return header + 1;
+}
+
+void frArena::release(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto header = static_cast<frArenaHeader*>(ptr) - 1;
+  auto arena  = header->arena;
+  if (arena) {
+    void* block = header;
+    *static_cast<void**>(block) = arena->freeLists[header->sizeClass];
+    arena->freeLists[header->sizeClass] = block;
+  } else {
+    ::operator delete(header);
+  }
+}
@@ -0,0 +1,90 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FR_ARENA_H_
+#define _FR_ARENA_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace fr {
+  // Pool for the objects of one worker. Blocks are recycled through
+  // per-size free lists and all memory is returned at once when the arena
+  // is destroyed. allocate(nullptr, size) falls back to the heap, release
+  // finds the owner from the block header. An arena is used by one thread
+  // at a time.
+  class frArena {
+  public:
+    frArena(): chunks(), freeLists(NUMSIZECLASSES, nullptr), currPos(nullptr), currEnd(nullptr), numBytes(0) {}
+    frArena(const frArena&) = delete;
+    frArena& operator=(const frArena&) = delete;
+    ~frArena();
+    // getters
+    std::size_t getNumBytes() const {
+      return numBytes;
+    }
+    // others
+    static void* allocate(frArena* arena, std::size_t size);
+    static void  release(void* ptr);
+  protected:
+    // precedes every block, keeps user memory 16-byte aligned
+    struct frArenaHeader {
+      frArena*    arena; // nullptr: from the heap
+      std::size_t sizeClass;
+    };
+    static constexpr std::size_t GRANULE        = 16;
+    static constexpr std::size_t NUMSIZECLASSES = 32; // blocks up to 512 bytes
+    static constexpr std::size_t CHUNKSIZE      = 64 * 1024;
+
+    std::vector<char*> chunks;
+    std::vector<void*> freeLists;
+    char*              currPos;
+    char*              currEnd;
+    std::size_t        numBytes;
+
+    void* allocateBlock(std::size_t sizeClass);
+  };
+
+  // installs an arena for the calling thread while in scope and restores the
+  // previous one, also when an exception leaves the scope; T is the object
+  // family that allocates from it (drBlockObject, gcBlockObject)
+  template <class T>
+  class frArenaScope {
+  public:
+    explicit frArenaScope(frArena* in): prevArena(T::setArena(in)) {}
+    frArenaScope(const frArenaScope&) = delete;
+    frArenaScope& operator=(const frArenaScope&) = delete;
+    ~frArenaScope() {
+      T::setArena(prevArena);
+    }
+  protected:
+    frArena* prevArena;
+  };
+}
+
+#endif
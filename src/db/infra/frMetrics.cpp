@@ -0,0 +1,87 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <mutex>
+#include "global.h"
+#include "frTime.h"
+#include "frMetrics.h"
+
+using namespace std;
+using namespace fr;
+
+namespace {
+  mutex    metricsMutex;
+  ofstream metricsOut;
+  bool     metricsFailed = false;
+  // tells apart the runs appending to the same file
+  const long long runId = chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+bool frMetrics::isEnabled() {
+  return METRICS_FILE != "";
+}
+
+frMetrics::~frMetrics() {
+  if (!isEnabled()) {
+    return;
+  }
+  auto t1 = chrono::high_resolution_clock::now();
+  double wall = chrono::duration_cast<chrono::duration<double> >(t1 - t0).count();
+  double cpu  = (clock() - t) * 1.0 / CLOCKS_PER_SEC;
+  stringstream ss;
+  ss <<fixed <<setprecision(3);
+  ss <<"{\"run\":" <<runId <<",\"phase\":\"" <<phase <<"\"";
+  if (iter >= 0) {
+    ss <<",\"iter\":" <<iter;
+  }
+  ss <<",\"wall_s\":" <<wall <<",\"cpu_s\":" <<cpu
+     <<",\"rss_mb\":"      <<getCurrentRSS() * 1.0 / 1024 / 1024
+     <<",\"peak_rss_mb\":" <<getPeakRSS()    * 1.0 / 1024 / 1024
+     <<",\"threads\":"     <<MAX_THREADS;
+  for (auto &[name, value]: counters) {
+    ss <<",\"" <<name <<"\":" <<value;
+  }
+  ss <<"}" <<endl;
+
+  lock_guard<mutex> lock(metricsMutex);
+  if (metricsFailed) {
+    return;
+  }
+  if (!metricsOut.is_open()) {
+    metricsOut.open(METRICS_FILE, ios::app);
+    if (!metricsOut.is_open()) {
+      cout <<"Warning: cannot open metrics file " <<METRICS_FILE <<", no metrics are recorded" <<endl;
+      metricsFailed = true;
+      return;
+    }
+  }
+  metricsOut <<ss.str() <<flush;
+}
@@ -0,0 +1,61 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FR_METRICS_H_
+#define _FR_METRICS_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <ctime>
+
+namespace fr {
+  // Records wall time, cpu time and memory of one phase (and the counters
+  // added to it) as one JSON object per line in METRICS_FILE. The record is
+  // written when the object goes out of scope; nothing is done if
+  // METRICS_FILE is empty.
+  class frMetrics {
+  public:
+    frMetrics(const std::string &phaseIn, int iterIn = -1):
+      phase(phaseIn), iter(iterIn), t0(std::chrono::high_resolution_clock::now()), t(clock()), counters() {}
+    ~frMetrics();
+    void add(const std::string &name, long long value) {
+      counters.push_back(std::make_pair(name, value));
+    }
+    static bool isEnabled();
+  protected:
+    std::string                                          phase;
+    int                                                  iter;
+    std::chrono::high_resolution_clock::time_point       t0;
+    clock_t                                              t;
+    std::vector<std::pair<std::string, long long> >      counters;
+  };
+}
+
+#endif
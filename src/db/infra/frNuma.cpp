@@ -0,0 +1,118 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <sched.h>
+#include <unistd.h>
+#include "frNuma.h"
+
+using namespace std;
+using namespace fr;
+
+namespace {
+  // parses a sysfs list such as "0-3,8-11"
+  bool readList(const string &fileName, vector<int> &out) {
+    ifstream fin(fileName);
+    string line;
+    if (!fin.is_open() || !getline(fin, line)) {
+      return false;
+    }
+    out.clear();
+    stringstream ss(line);
+    string range;
+    while (getline(ss, range, ',')) {
+      if (range.empty()) {
+        continue;
+      }
+      auto pos = range.find('-');
+      int begin = stoi(range.substr(0, pos));
+      int end   = (pos == string::npos) ? begin : stoi(range.substr(pos + 1));
+      for (int i = begin; i <= end; i++) {
+        out.push_back(i);
+      }
+    }
+    return !out.empty();
+  }
+}
+
+frNuma::frNuma(): nodeCpus(), nodeIds() {
+  // the mask of the constructing thread, which is not bound yet
+  cpu_set_t allowed;
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    CPU_ZERO(&allowed);
+    int numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int i = 0; i < min(max(numCpus, 1), CPU_SETSIZE); i++) {
+      CPU_SET(i, &allowed);
+    }
+  }
+  auto isAllowed = [&](int cpu) {
+    return cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed);
+  };
+  vector<int> nodes;
+  if (readList("/sys/devices/system/node/online", nodes)) {
+    for (auto node: nodes) {
+      vector<int> cpus;
+      // memory-only nodes have no cpus
+      if (!readList("/sys/devices/system/node/node" + to_string(node) + "/cpulist", cpus)) {
+        continue;
+      }
+      cpus.erase(remove_if(cpus.begin(), cpus.end(), [&](int cpu) { return !isAllowed(cpu); }), cpus.end());
+      if (!cpus.empty()) {
+        nodeCpus.push_back(cpus);
+        nodeIds.push_back(node);
+      }
+    }
+  }
+  if (nodeCpus.empty()) {
+    nodeCpus.resize(1);
+    nodeIds.assign(1, 0);
+    for (int i = 0; i < CPU_SETSIZE; i++) {
+      if (isAllowed(i)) {
+        nodeCpus[0].push_back(i);
+      }
+    }
+  }
+}
+
+bool frNuma::bindThread(int node, cpu_set_t &prevMask) const {
+  if (sched_getaffinity(0, sizeof(prevMask), &prevMask) != 0) {
+    return false;
+  }
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for (auto cpu: nodeCpus[node]) {
+    CPU_SET(cpu, &cpuSet);
+  }
+  return (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0);
+}
+
+bool frNuma::restoreThread(const cpu_set_t &prevMask) const {
+  return (sched_setaffinity(0, sizeof(prevMask), &prevMask) == 0);
+}
@@ -0,0 +1,67 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FR_NUMA_H_
+#define _FR_NUMA_H_
+
+#include <vector>
+#include <sched.h>
+
+namespace fr {
+  // NUMA nodes and their cpus as listed in /sys/devices/system/node, limited
+  // to the cpus the process may run on (taskset, cpusets); nodes without any
+  // of those are left out. When the information is missing the machine is
+  // one node with every allowed cpu.
+  class frNuma {
+  public:
+    frNuma();
+    // getters
+    int getNumNodes() const {
+      return nodeCpus.size();
+    }
+    const std::vector<int>& getCpus(int node) const {
+      return nodeCpus[node];
+    }
+    // sysfs number of node
+    int getNodeId(int node) const {
+      return nodeIds[node];
+    }
+    // others
+    // restricts the calling thread to the cpus of node and saves its previous
+    // mask in prevMask; with the default local allocation policy the memory
+    // it touches first then comes from that node
+    bool bindThread(int node, cpu_set_t &prevMask) const;
+    // restores a mask saved by bindThread
+    bool restoreThread(const cpu_set_t &prevMask) const;
+  protected:
+    std::vector<std::vector<int> > nodeCpus;
+    std::vector<int>               nodeIds;
+  };
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include "db/infra/frPoint.h"
 #include "db/obj/frBlockObject.h"
 #include <iostream>
+#include <memory>
 
 namespace fr {
   class frViaDef;
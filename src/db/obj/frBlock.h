@@ -30,6 +30,8 @@
 #define _FR_BLOCK_H_
 
 #include <algorithm>
+#include <string_view>
+#include <unordered_map>
 #include "frBaseTypes.h"
 #include "db/obj/frTrackPattern.h"
 #include "db/obj/frBlockage.h"
@@ -131,9 +133,17 @@ namespace fr {
     const std::vector<std::unique_ptr<frInst> >& getInsts() const {
       return insts;
     }
+    frInst* getInst(std::string_view in) const {
+      auto it = name2inst.find(in);
+      return (it == name2inst.end()) ? nullptr : it->second;
+    }
     const std::vector<std::unique_ptr<frNet> >& getNets() const {
       return nets;
     }
+    frNet* getNet(std::string_view in) const {
+      auto it = name2net.find(in);
+      return (it == name2net.end()) ? nullptr : it->second;
+    }
     const std::vector<std::unique_ptr<frNet> >& getSNets() const {
       return snets;
     }
@@ -152,7 +162,7 @@ namespace fr {
     const std::vector<std::unique_ptr<frTerm> >& getTerms() const {
       return terms;
     }
-    frTerm* getTerm(const std::string &in) const {
+    frTerm* getTerm(std::string_view in) const {
       auto it = name2term.find(in);
       if (it == name2term.end()) {
         return nullptr;
@@ -318,16 +328,18 @@ namespace fr {
 
     MacroClassEnum                                                macroClass;
 
-    std::map<std::string, frInst*>                                name2inst;
+    // name indices are hashed and key on views of the objects' own names,
+    // which stay put since the objects are owned through unique_ptr
+    std::unordered_map<std::string_view, frInst*>                 name2inst;
     std::vector<std::unique_ptr<frInst> >                         insts;
 
-    std::map<std::string, frTerm*>                                name2term;
+    std::unordered_map<std::string_view, frTerm*>                 name2term;
     std::vector<std::unique_ptr<frTerm> >                         terms;
 
-    std::map<std::string, frNet*>                                 name2net;
+    std::unordered_map<std::string_view, frNet*>                  name2net;
     std::vector<std::unique_ptr<frNet> >                          nets;
     
-    std::map<std::string, frNet*>                                 name2snet;
+    std::unordered_map<std::string_view, frNet*>                  name2snet;
     std::vector<std::unique_ptr<frNet> >                          snets;
 
     std::vector<std::unique_ptr<frBlockage> >                     blockages;
@@ -29,6 +29,7 @@
 #ifndef _FR_NET_H_
 #define _FR_NET_H_
 
+#include <algorithm>
 #include "frBaseTypes.h"
 #include "db/obj/frBlockObject.h"
 #include "db/obj/frGuide.h"
@@ -79,6 +80,12 @@ namespace fr {
     void addTerm(frTerm* in) {
       terms.push_back(in);
     }
+    void removeInstTerm(frInstTerm* in) {
+      instTerms.erase(std::remove(instTerms.begin(), instTerms.end(), in), instTerms.end());
+    }
+    void removeTerm(frTerm* in) {
+      terms.erase(std::remove(terms.begin(), terms.end(), in), terms.end());
+    }
     void setName(const frString &stringIn) {
       name = stringIn;
     }
@@ -30,6 +30,7 @@
 #define _FR_TECHOBJECT_H_
 
 #include <map>
+#include <unordered_map>
 #include <iostream>
 #include <vector>
 #include <memory>
@@ -54,12 +55,13 @@ namespace fr {
       return manufacturingGrid;
     }
     frLayer* getLayer(const frString &name) const {
-      if (name2layer.find(name) == name2layer.end()) {
+      auto it = name2layer.find(name);
+      if (it == name2layer.end()) {
         // std::cout <<"Error: cannot find layer" <<std::endl;
         // exit(1);
         return nullptr;
       } else {
-        return name2layer.at(name);
+        return it->second;
       }
     }
     frLayer* getLayer(frLayerNum in) const {
@@ -86,6 +88,12 @@ namespace fr {
     const std::vector<std::unique_ptr<frViaRuleGenerate> >& getViaRuleGenerates() const {
       return viaRuleGenerates;
     }
+    const frCollection<std::shared_ptr<frConstraint> >& getConstraints() const {
+      return constraints;
+    }
+    const std::vector<std::unique_ptr<frConstraint> >& getUConstraints() const {
+      return uConstraints;
+    }
     const std::vector<std::vector<std::vector<std::pair<frCoord, frCoord> > > >& getVia2ViaForbiddenLen() const {
       return via2ViaForbiddenLen;
     }
@@ -95,6 +103,21 @@ namespace fr {
     const std::vector<std::vector<std::vector<std::pair<frCoord, frCoord> > > >& getViaForbiddenPlanarLen() const {
       return viaForbiddenPlanarLen;
     }
+    const std::vector<frCoord>& getHalfViaEncArea() const {
+      return halfViaEncArea;
+    }
+    const std::vector<frCoord>& getVia2ViaMinLen() const {
+      return via2ViaMinLen;
+    }
+    const std::vector<char>& getVia2ViaZeroLen() const {
+      return via2ViaZeroLen;
+    }
+    const std::vector<frCoord>& getVia2ViaMinLenNew() const {
+      return via2ViaMinLenNew;
+    }
+    const std::vector<frCoord>& getVia2TurnMinLen() const {
+      return via2TurnMinLen;
+    }
 
     // setters
     void setDBUPerUU(frUInt4 uIn) {
@@ -191,10 +214,10 @@ namespace fr {
     frUInt4                                          dbUnit;
     frUInt4                                          manufacturingGrid;
 
-    std::map<frString, frLayer*>                     name2layer;
+    std::unordered_map<frString, frLayer*>           name2layer;
     std::vector<std::unique_ptr<frLayer> >           layers;
 
-    std::map<frString, frViaDef*>                    name2via;
+    std::unordered_map<frString, frViaDef*>          name2via;
     std::vector<std::unique_ptr<frViaDef> >          vias;
 
     std::vector<std::map<frString, frLef58CutClass*> > layer2Name2CutClass;
@@ -250,6 +273,19 @@ namespace fr {
     // viaForbiddenPlanarThrough[z][3], forbidden planar through along y direction for up via
     std::vector<std::vector<bool> > viaForbiddenThrough;
 
+    // min length tables used by dr, flat and indexed by z and via direction bits
+    // halfViaEncArea[z * 2 + 0], half enclosure area of up via on layer z
+    // halfViaEncArea[z * 2 + 1], half enclosure area of up via on layer z + 1
+    std::vector<frCoord> halfViaEncArea;
+    // via2ViaMinLen[z * 4 + isPrevViaUp * 2 + isCurrViaUp], min required dist
+    std::vector<frCoord> via2ViaMinLen;
+    // via2ViaZeroLen[z * 4 + isPrevViaUp * 2 + isCurrViaUp], zero length allowed
+    std::vector<char> via2ViaZeroLen;
+    // via2ViaMinLenNew[z * 8 + isPrevViaUp * 4 + isCurrViaUp * 2 + isCurrDirY], min required dist
+    std::vector<frCoord> via2ViaMinLenNew;
+    // via2TurnMinLen[z * 4 + isPrevViaUp * 2 + isCurrDirY], min required dist before turn
+    std::vector<frCoord> via2TurnMinLen;
+
     // forbidden length table related utilities
     int getTableEntryIdx(bool in1, bool in2) {
       int retIdx = 0;
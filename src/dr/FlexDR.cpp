@@ -28,10 +28,14 @@
 
 #include <chrono>
 #include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
 #include <boost/io/ios_state.hpp>
 #include "frProfileTask.h"
 #include "dr/FlexDR.h"
 #include "db/infra/frTime.h"
+#include "db/infra/frMetrics.h"
 #include <omp.h>
 
 using namespace std;
@@ -51,11 +55,15 @@ int FlexDRWorker::main() {
     cout <<ss.str() <<flush;
   }
 
-  init();
-  high_resolution_clock::time_point t1 = high_resolution_clock::now();
-  route();
-  high_resolution_clock::time_point t2 = high_resolution_clock::now();
-  end();
+  high_resolution_clock::time_point t1, t2;
+  {
+    frArenaScope<drBlockObject> arenaScope(&arena);
+    init();
+    t1 = high_resolution_clock::now();
+    route();
+    t2 = high_resolution_clock::now();
+    end();
+  }
   high_resolution_clock::time_point t3 = high_resolution_clock::now();
 
   duration<double> time_span0 = duration_cast<duration<double>>(t1 - t0);
@@ -88,20 +96,34 @@ int FlexDRWorker::main_mt() {
     cout <<ss.str() <<flush;
   }
 
-  init();
-  high_resolution_clock::time_point t1 = high_resolution_clock::now();
-  if (getFixMode() != 9) {
-    route();
-  } else {
-   route_queue();
+  // dr objects of this worker come from its arena, which is released with
+  // the worker since end() still reads the routes after cleanup()
+  high_resolution_clock::time_point t1, t2;
+  {
+    frArenaScope<drBlockObject> arenaScope(&arena);
+    init();
+    t1 = high_resolution_clock::now();
+    if (getFixMode() != 9) {
+      route();
+    } else {
+     route_queue();
+    }
+    t2 = high_resolution_clock::now();
+    // grid graph is released by cleanup
+    workerStat.numNets = nets.size();
+    gridGraph.getDim(workerStat.xDim, workerStat.yDim, workerStat.zDim);
+    cleanup();
   }
-  high_resolution_clock::time_point t2 = high_resolution_clock::now();
-  cleanup();
   high_resolution_clock::time_point t3 = high_resolution_clock::now();
 
   duration<double> time_span0 = duration_cast<duration<double>>(t1 - t0);
   duration<double> time_span1 = duration_cast<duration<double>>(t2 - t1);
   duration<double> time_span2 = duration_cast<duration<double>>(t3 - t2);
+  workerStat.routeBox    = routeBox;
+  workerStat.numExpanded = getNumNodesExpanded();
+  workerStat.initTime    = time_span0.count();
+  workerStat.routeTime   = time_span1.count();
+  workerStat.postTime    = time_span2.count();
 
   if (VERBOSE > 1) {
     stringstream ss;
@@ -155,6 +177,9 @@ void FlexDR::initGCell2BoundaryPin() {
   gcell2BoundaryPin = vector<vector<map<frNet*, set<pair<frPoint, frLayerNum> >, frBlockObjectComp> > >((int)xgp.getCount(), tmpVec);
   for (auto &net: getDesign()->getTopBlock()->getNets()) {
     auto netPtr = net.get();
+    if (!ecoNets.empty() && !isEcoNet(netPtr)) {
+      continue;
+    }
     for (auto &guide: net->getGuides()) {
       for (auto &connFig: guide->getRoutes()) {
         if (connFig->typeId() == frcPathSeg) {
@@ -273,980 +298,129 @@ void FlexDR::initGCell2BoundaryPin() {
   }
 }
 
-frCoord FlexDR::init_via2viaMinLen_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2) {
-  if (!(viaDef1 && viaDef2)) {
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  bool isH = (getDesign()->getTech()->getLayer(lNum)->getDir() == frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
-
-  bool isVia1Above = false;
-  frVia via1(viaDef1);
-  frBox viaBox1, cutBox1;
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-    isVia1Above = true;
-  } else {
-    via1.getLayer2BBox(viaBox1);
-    isVia1Above = false;
-  }
-  via1.getCutBBox(cutBox1);
-  auto width1    = viaBox1.width();
-  auto length1   = viaBox1.length();
-
-  bool isVia2Above = false;
-  frVia via2(viaDef2);
-  frBox viaBox2, cutBox2;
-  if (viaDef2->getLayer1Num() == lNum) {
-    via2.getLayer1BBox(viaBox2);
-    isVia2Above = true;
-  } else {
-    via2.getLayer2BBox(viaBox2);
-    isVia2Above = false;
-  }
-  via2.getCutBBox(cutBox2);
-  auto width2    = viaBox2.width();
-  auto length2   = viaBox2.length();
-
-  for (auto &con: getDesign()->getTech()->getLayer(lNum)->getMinimumcutConstraints()) {
-    if ((!con->hasLength() || (con->hasLength() && length1 > con->getLength())) && 
-        width1 > con->getWidth()) {
-      bool checkVia2 = false;
-      if (!con->hasConnection()) {
-        checkVia2 = true;
-      } else {
-        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia2Above) {
-          checkVia2 = true;
-        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia2Above) {
-          checkVia2 = true;
-        }
-      }
-      if (!checkVia2) {
-        continue;
-      }
-      if (isH) {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox2.right() - 0 + 0 - viaBox1.left(), 
-                           viaBox1.right() - 0 + 0 - cutBox2.left()));
-      } else {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox2.top() - 0 + 0 - viaBox1.bottom(), 
-                           viaBox1.top() - 0 + 0 - cutBox2.bottom()));
-      }
-    } 
-    // check via1cut to via2metal
-    if ((!con->hasLength() || (con->hasLength() && length2 > con->getLength())) && 
-        width2 > con->getWidth()) {
-      bool checkVia1 = false;
-      if (!con->hasConnection()) {
-        checkVia1 = true;
-      } else {
-        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia1Above) {
-          checkVia1 = true;
-        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia1Above) {
-          checkVia1 = true;
-        }
-      }
-      if (!checkVia1) {
-        continue;
-      }
-      if (isH) {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox1.right() - 0 + 0 - viaBox2.left(), 
-                           viaBox2.right() - 0 + 0 - cutBox1.left()));
-      } else {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox1.top() - 0 + 0 - viaBox2.bottom(), 
-                           viaBox2.top() - 0 + 0 - cutBox1.bottom()));
-      }
+bool FlexDR::isEcoClip(const frBox &routeBox) {
+  vector<frGuide*> guides;
+  getRegionQuery()->queryGuide(routeBox, guides);
+  for (auto guide: guides) {
+    if (isEcoNet(guide->getNet())) {
+      return true;
     }
   }
-
-  return sol;
+  return false;
 }
 
-bool FlexDR::init_via2viaMinLen_minimumcut2(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2) {
-  if (!(viaDef1 && viaDef2)) {
-    return true;
-  }
-  // skip if same-layer via
-  if (viaDef1 == viaDef2) {
-    return true;
-  }
-
-  bool sol = true;
-
-  bool isVia1Above = false;
-  frVia via1(viaDef1);
-  frBox viaBox1, cutBox1;
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-    isVia1Above = true;
-  } else {
-    via1.getLayer2BBox(viaBox1);
-    isVia1Above = false;
-  }
-  via1.getCutBBox(cutBox1);
-  auto width1    = viaBox1.width();
-
-  bool isVia2Above = false;
-  frVia via2(viaDef2);
-  frBox viaBox2, cutBox2;
-  if (viaDef2->getLayer1Num() == lNum) {
-    via2.getLayer1BBox(viaBox2);
-    isVia2Above = true;
-  } else {
-    via2.getLayer2BBox(viaBox2);
-    isVia2Above = false;
-  }
-  via2.getCutBBox(cutBox2);
-  auto width2    = viaBox2.width();
-
-  for (auto &con: getDesign()->getTech()->getLayer(lNum)->getMinimumcutConstraints()) {
-    if (con->hasLength()) {
-      continue;
-    }
-    // check via2cut to via1metal
-    if (width1 > con->getWidth()) {
-      bool checkVia2 = false;
-      if (!con->hasConnection()) {
-        checkVia2 = true;
-      } else {
-        // has length rule
-        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia2Above) {
-          checkVia2 = true;
-        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia2Above) {
-          checkVia2 = true;
-        }
-      }
-      if (!checkVia2) {
-        continue;
-      }
-      sol = false;
-      break;
-    } 
-    // check via1cut to via2metal
-    if (width2 > con->getWidth()) {
-      bool checkVia1 = false;
-      if (!con->hasConnection()) {
-        checkVia1 = true;
-      } else {
-        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia1Above) {
-          checkVia1 = true;
-        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia1Above) {
-          checkVia1 = true;
-        }
-      }
-      if (!checkVia1) {
-        continue;
-      }
-      sol = false;
-      break;
-    }
-  }
-  return sol;
-}
-
-frCoord FlexDR::init_via2viaMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2) {
-  if (!(viaDef1 && viaDef2)) {
-    //cout <<"hehehehehe" <<endl;
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  bool isH = (getDesign()->getTech()->getLayer(lNum)->getDir() == frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
-  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
-
-  frVia via1(viaDef1);
-  frBox viaBox1;
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-  } else {
-    via1.getLayer2BBox(viaBox1);
-  }
-  auto width1    = viaBox1.width();
-  bool isVia1Fat = isH ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
-  auto prl1      = isH ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
-
-  frVia via2(viaDef2);
-  frBox viaBox2;
-  if (viaDef2->getLayer1Num() == lNum) {
-    via2.getLayer1BBox(viaBox2);
-  } else {
-    via2.getLayer2BBox(viaBox2);
-  }
-  auto width2    = viaBox2.width();
-  bool isVia2Fat = isH ? (viaBox2.top() - viaBox2.bottom() > defaultWidth) : (viaBox2.right() - viaBox2.left() > defaultWidth);
-  auto prl2      = isH ? (viaBox2.top() - viaBox2.bottom()) : (viaBox2.right() - viaBox2.left());
-
-  frCoord reqDist = 0;
-  if (isVia1Fat && isVia2Fat) {
-    auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
-    if (con) {
-      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
-        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
-        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), min(prl1, prl2));
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
-        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, min(prl1, prl2));
-      }
-    }
-    if (isH) {
-      reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
-      reqDist += max((viaBox2.right() - 0), (0 - viaBox2.left()));
-    } else {
-      reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
-      reqDist += max((viaBox2.top() - 0), (0 - viaBox2.bottom()));
-    }
-    sol = max(sol, reqDist);
-  }
-
-  // check min len in layer2 if two vias are in same layer
-  if (viaDef1 != viaDef2) {
-    return sol;
-  }
-
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer2BBox(viaBox1);
-    lNum = lNum + 2;
-  } else {
-    via1.getLayer1BBox(viaBox1);
-    lNum = lNum - 2;
-  }
-  width1    = viaBox1.width();
-  prl1      = isH ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
-  reqDist   = 0;
-  auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
-  if (con) {
-    if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
-      reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
-    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
-      reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), prl1);
-    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
-      reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, prl1);
-    }
+void FlexDR::init() {
+  ProfileTask profile("DR:init");
+  frTime t;
+  if (VERBOSE > 0) {
+    cout <<endl <<"start routing data preparation" <<endl;
   }
-  if (isH) {
-    reqDist += (viaBox1.right() - 0) + (0 - viaBox1.left());
+  if (DR_RESTART_FILE != "" && ecoNets.empty()) {
+    // boundary pins are only needed by iteration 0, which is never resumed
+    startIter = readCheckpoint(DR_RESTART_FILE) + 1;
   } else {
-    reqDist += (viaBox1.top() - 0) + (0 - viaBox1.bottom());
-  }
-  sol = max(sol, reqDist);
-  
-  return sol;
-}
-
-void FlexDR::init_via2viaMinLen() {
-  //bool enableOutput = false;
-  bool enableOutput = true;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum    = getDesign()->getTech()->getTopLayerNum();
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    vector<frCoord> via2viaMinLenTmp(4, 0);
-    vector<bool>    via2viaZeroLen(4, true);
-    via2viaMinLen.push_back(make_pair(via2viaMinLenTmp, via2viaZeroLen));
+    initGCell2BoundaryPin();
   }
-  // check prl
-  int i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    (via2viaMinLen[i].first)[0] = max((via2viaMinLen[i].first)[0], init_via2viaMinLen_minSpc(lNum, downVia, downVia));
-    (via2viaMinLen[i].first)[1] = max((via2viaMinLen[i].first)[1], init_via2viaMinLen_minSpc(lNum, downVia, upVia));
-    (via2viaMinLen[i].first)[2] = max((via2viaMinLen[i].first)[2], init_via2viaMinLen_minSpc(lNum, upVia, downVia));
-    (via2viaMinLen[i].first)[3] = max((via2viaMinLen[i].first)[3], init_via2viaMinLen_minSpc(lNum, upVia, upVia));
-    if (enableOutput) {
-      cout <<"initVia2ViaMinLen_minSpc " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (d2d, d2u, u2d, u2u) = (" 
-           <<(via2viaMinLen[i].first)[0] <<", "
-           <<(via2viaMinLen[i].first)[1] <<", "
-           <<(via2viaMinLen[i].first)[2] <<", "
-           <<(via2viaMinLen[i].first)[3] <<")" <<endl;
-    }
-    i++;
+  getRegionQuery()->initDRObj(getTech()->getLayers().size()); // first init in postProcess
+  initLayerCostInfo();
+  // incremental runs are local to the changed nets, they do not restart or distribute
+  if (ecoNets.empty()) {
+    dist_init();
   }
 
-  // check minimumcut
-  i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    vector<frCoord> via2viaMinLenTmp(4, 0);
-    (via2viaMinLen[i].first)[0] = max((via2viaMinLen[i].first)[0], init_via2viaMinLen_minimumcut1(lNum, downVia, downVia));
-    (via2viaMinLen[i].first)[1] = max((via2viaMinLen[i].first)[1], init_via2viaMinLen_minimumcut1(lNum, downVia, upVia));
-    (via2viaMinLen[i].first)[2] = max((via2viaMinLen[i].first)[2], init_via2viaMinLen_minimumcut1(lNum, upVia, downVia));
-    (via2viaMinLen[i].first)[3] = max((via2viaMinLen[i].first)[3], init_via2viaMinLen_minimumcut1(lNum, upVia, upVia));
-    (via2viaMinLen[i].second)[0] = (via2viaMinLen[i].second)[0] && init_via2viaMinLen_minimumcut2(lNum, downVia, downVia);
-    (via2viaMinLen[i].second)[1] = (via2viaMinLen[i].second)[1] && init_via2viaMinLen_minimumcut2(lNum, downVia, upVia);
-    (via2viaMinLen[i].second)[2] = (via2viaMinLen[i].second)[2] && init_via2viaMinLen_minimumcut2(lNum, upVia, downVia);
-    (via2viaMinLen[i].second)[3] = (via2viaMinLen[i].second)[3] && init_via2viaMinLen_minimumcut2(lNum, upVia, upVia);
-    if (enableOutput) {
-      cout <<"initVia2ViaMinLen_minimumcut " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (d2d, d2u, u2d, u2u) = (" 
-           <<(via2viaMinLen[i].first)[0] <<", "
-           <<(via2viaMinLen[i].first)[1] <<", "
-           <<(via2viaMinLen[i].first)[2] <<", "
-           <<(via2viaMinLen[i].first)[3] <<")" <<endl;
-      cout <<"initVia2ViaMinLen_minimumcut " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" zerolen (b, b, b, b) = (" 
-           <<(via2viaMinLen[i].second)[0] <<", "
-           <<(via2viaMinLen[i].second)[1] <<", "
-           <<(via2viaMinLen[i].second)[2] <<", "
-           <<(via2viaMinLen[i].second)[3] <<")" 
-           <<endl;
-    }
-    i++;
+  if (VERBOSE > 0) {
+    t.print();
   }
 }
 
-frCoord FlexDR::init_via2viaMinLenNew_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY) {
-  if (!(viaDef1 && viaDef2)) {
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  bool isCurrDirX = !isCurrDirY;
-
-  bool isVia1Above = false;
-  frVia via1(viaDef1);
-  frBox viaBox1, cutBox1;
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-    isVia1Above = true;
-  } else {
-    via1.getLayer2BBox(viaBox1);
-    isVia1Above = false;
-  }
-  via1.getCutBBox(cutBox1);
-  auto width1    = viaBox1.width();
-  auto length1   = viaBox1.length();
-
-  bool isVia2Above = false;
-  frVia via2(viaDef2);
-  frBox viaBox2, cutBox2;
-  if (viaDef2->getLayer1Num() == lNum) {
-    via2.getLayer1BBox(viaBox2);
-    isVia2Above = true;
-  } else {
-    via2.getLayer2BBox(viaBox2);
-    isVia2Above = false;
-  }
-  via2.getCutBBox(cutBox2);
-  auto width2    = viaBox2.width();
-  auto length2   = viaBox2.length();
-
-  for (auto &con: getDesign()->getTech()->getLayer(lNum)->getMinimumcutConstraints()) {
-    // check via2cut to via1metal
-    // no length OR metal1 shape satisfies --> check via2
-    if ((!con->hasLength() || (con->hasLength() && length1 > con->getLength())) && 
-        width1 > con->getWidth()) {
-      bool checkVia2 = false;
-      if (!con->hasConnection()) {
-        checkVia2 = true;
-      } else {
-        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia2Above) {
-          checkVia2 = true;
-        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia2Above) {
-          checkVia2 = true;
+void FlexDR::initLayerCostInfo() {
+  auto tech = getTech();
+  layerCostInfos.clear();
+  layerCostInfos.resize(tech->getLayers().size());
+  for (auto &layer: tech->getLayers()) {
+    auto lNum  = layer->getLayerNum();
+    auto &info = layerCostInfos[lNum];
+    info.viaDefL          = nullptr;
+    info.viaDefU          = nullptr;
+    info.viaBoxL.set(0, 0, 0, 0);
+    info.viaBoxU.set(0, 0, 0, 0);
+    info.isFatViaL        = false;
+    info.isFatViaU        = false;
+    info.patchLength      = 0;
+    info.eolBloatXL       = 0;
+    info.eolBloatYL       = 0;
+    info.eolBloatXU       = 0;
+    info.eolBloatYU       = 0;
+    info.cutViaDef        = nullptr;
+    info.cutBox.set(0, 0, 0, 0);
+    info.cutBloat         = 0;
+    info.cutBloatBlockage = 0;
+    if (layer->getType() == frLayerTypeEnum::CUT) {
+      info.cutViaDef = layer->getDefaultViaDef();
+      if (info.cutViaDef) {
+        frVia via(info.cutViaDef);
+        via.getCutBBox(info.cutBox);
+        frBox figBox;
+        for (auto &uFig: info.cutViaDef->getCutFigs()) {
+          static_cast<frRect*>(uFig.get())->getBBox(figBox);
+          info.cutFigBoxes.push_back(figBox);
         }
       }
-      if (!checkVia2) {
-        continue;
-      }
-      if (isCurrDirX) {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox2.right() - 0 + 0 - viaBox1.left(), 
-                           viaBox1.right() - 0 + 0 - cutBox2.left()));
-      } else {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox2.top() - 0 + 0 - viaBox1.bottom(), 
-                           viaBox1.top() - 0 + 0 - cutBox2.bottom()));
-      }
-    } 
-    // check via1cut to via2metal
-    if ((!con->hasLength() || (con->hasLength() && length2 > con->getLength())) && 
-        width2 > con->getWidth()) {
-      bool checkVia1 = false;
-      if (!con->hasConnection()) {
-        checkVia1 = true;
-      } else {
-        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia1Above) {
-          checkVia1 = true;
-        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia1Above) {
-          checkVia1 = true;
+      for (auto con: layer->getCutSpacing()) {
+        info.cutBloat         = max(info.cutBloat, con->getCutSpacing());
+        info.cutBloatBlockage = max(info.cutBloatBlockage, con->getCutSpacing());
+        if (con->getAdjacentCuts() != -1) {
+          info.cutBloatBlockage = max(info.cutBloatBlockage, con->getCutWithin());
         }
       }
-      if (!checkVia1) {
-        continue;
-      }
-      if (isCurrDirX) {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox1.right() - 0 + 0 - viaBox2.left(), 
-                           viaBox2.right() - 0 + 0 - cutBox1.left()));
-      } else {
-        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
-                       max(cutBox1.top() - 0 + 0 - viaBox2.bottom(), 
-                           viaBox2.top() - 0 + 0 - cutBox1.bottom()));
-      }
-    }
-  }
-
-  return sol;
-}
-
-frCoord FlexDR::init_via2viaMinLenNew_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY) {
-  if (!(viaDef1 && viaDef2)) {
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  bool isCurrDirX = !isCurrDirY;
-  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
-
-  frVia via1(viaDef1);
-  frBox viaBox1;
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-  } else {
-    via1.getLayer2BBox(viaBox1);
-  }
-  auto width1    = viaBox1.width();
-  bool isVia1Fat = isCurrDirX ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
-  auto prl1      = isCurrDirX ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
-
-  frVia via2(viaDef2);
-  frBox viaBox2;
-  if (viaDef2->getLayer1Num() == lNum) {
-    via2.getLayer1BBox(viaBox2);
-  } else {
-    via2.getLayer2BBox(viaBox2);
-  }
-  auto width2    = viaBox2.width();
-  bool isVia2Fat = isCurrDirX ? (viaBox2.top() - viaBox2.bottom() > defaultWidth) : (viaBox2.right() - viaBox2.left() > defaultWidth);
-  auto prl2      = isCurrDirX ? (viaBox2.top() - viaBox2.bottom()) : (viaBox2.right() - viaBox2.left());
-
-  frCoord reqDist = 0;
-  if (isVia1Fat && isVia2Fat) {
-    auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
-    if (con) {
-      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
-        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
-        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), min(prl1, prl2));
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
-        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, min(prl1, prl2));
-      }
-    }
-    if (isCurrDirX) {
-      reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
-      reqDist += max((viaBox2.right() - 0), (0 - viaBox2.left()));
-    } else {
-      reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
-      reqDist += max((viaBox2.top() - 0), (0 - viaBox2.bottom()));
-    }
-    sol = max(sol, reqDist);
-  }
-
-  // check min len in layer2 if two vias are in same layer
-  if (viaDef1 != viaDef2) {
-    return sol;
-  }
-
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer2BBox(viaBox1);
-    lNum = lNum + 2;
-  } else {
-    via1.getLayer1BBox(viaBox1);
-    lNum = lNum - 2;
-  }
-  width1    = viaBox1.width();
-  prl1      = isCurrDirX ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
-  reqDist   = 0;
-  auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
-  if (con) {
-    if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
-      reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
-    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
-      reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), prl1);
-    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
-      reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, prl1);
-    }
-  }
-  if (isCurrDirX) {
-    reqDist += (viaBox1.right() - 0) + (0 - viaBox1.left());
-  } else {
-    reqDist += (viaBox1.top() - 0) + (0 - viaBox1.bottom());
-  }
-  sol = max(sol, reqDist);
-  
-  return sol;
-}
-
-frCoord FlexDR::init_via2viaMinLenNew_cutSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY) {
-  if (!(viaDef1 && viaDef2)) {
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  frVia via1(viaDef1);
-  frBox viaBox1, cutBox1;
-  if (viaDef1->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-  } else {
-    via1.getLayer2BBox(viaBox1);
-  }
-  via1.getCutBBox(cutBox1);
-
-  frVia via2(viaDef2);
-  frBox viaBox2, cutBox2;
-  if (viaDef2->getLayer1Num() == lNum) {
-    via2.getLayer1BBox(viaBox2);
-  } else {
-    via2.getLayer2BBox(viaBox2);
-  }
-  via2.getCutBBox(cutBox2);
-
-  // same layer (use samenet rule if exist, otherwise use diffnet rule)
-  if (viaDef1->getCutLayerNum() == viaDef2->getCutLayerNum()) {
-    auto samenetCons = getDesign()->getTech()->getLayer(viaDef1->getCutLayerNum())->getCutSpacing(true);
-    auto diffnetCons = getDesign()->getTech()->getLayer(viaDef1->getCutLayerNum())->getCutSpacing(false);
-    if (!samenetCons.empty()) {
-      // check samenet spacing rule if exists
-      for (auto con: samenetCons) {
-        if (con == nullptr) {
-          continue;
-        }
-        // filter rule, assuming default via will never trigger cutArea
-        if (con->hasSecondLayer() || con->isAdjacentCuts() || con->isParallelOverlap() || con->isArea() || !con->hasSameNet()) {
-          continue;
-        }
-        auto reqSpcVal = con->getCutSpacing();
-        if (!con->hasCenterToCenter()) {
-          reqSpcVal += isCurrDirY ? (cutBox1.top() - cutBox1.bottom()) : (cutBox1.right() - cutBox1.left());
-        }
-        sol = max(sol, reqSpcVal);
-      }
-    } else {
-      // check diffnet spacing rule
-      // filter rule, assuming default via will never trigger cutArea
-      for (auto con: diffnetCons) {
-        if (con == nullptr) {
-          continue;
-        }
-        if (con->hasSecondLayer() || con->isAdjacentCuts() || con->isParallelOverlap() || con->isArea() || con->hasSameNet()) {
-          continue;
-        }
-        auto reqSpcVal = con->getCutSpacing();
-        if (!con->hasCenterToCenter()) {
-          reqSpcVal += isCurrDirY ? (cutBox1.top() - cutBox1.bottom()) : (cutBox1.right() - cutBox1.left());
-        }
-        sol = max(sol, reqSpcVal);
-      }
-    }
-  // TODO: diff layer 
-  } else {
-    auto layerNum1 = viaDef1->getCutLayerNum();
-    auto layerNum2 = viaDef2->getCutLayerNum();
-    frCutSpacingConstraint* samenetCon = nullptr;
-    if (getDesign()->getTech()->getLayer(layerNum1)->hasInterLayerCutSpacing(layerNum2, true)) {
-      samenetCon = getDesign()->getTech()->getLayer(layerNum1)->getInterLayerCutSpacing(layerNum2, true);
-    }
-    if (getDesign()->getTech()->getLayer(layerNum2)->hasInterLayerCutSpacing(layerNum1, true)) {
-      if (samenetCon) {
-        cout <<"Warning: duplicate diff layer samenet cut spacing, skipping cut spacing from " 
-             <<layerNum2 <<" to " <<layerNum1 <<endl;
-      } else {
-        samenetCon = getDesign()->getTech()->getLayer(layerNum2)->getInterLayerCutSpacing(layerNum1, true);
-      }
-    }
-    if (samenetCon == nullptr) {
-      if (getDesign()->getTech()->getLayer(layerNum1)->hasInterLayerCutSpacing(layerNum2, false)) {
-        samenetCon = getDesign()->getTech()->getLayer(layerNum1)->getInterLayerCutSpacing(layerNum2, false);
-      }
-      if (getDesign()->getTech()->getLayer(layerNum2)->hasInterLayerCutSpacing(layerNum1, false)) {
-        if (samenetCon) {
-          cout <<"Warning: duplicate diff layer diffnet cut spacing, skipping cut spacing from " 
-               <<layerNum2 <<" to " <<layerNum1 <<endl;
-        } else {
-          samenetCon = getDesign()->getTech()->getLayer(layerNum2)->getInterLayerCutSpacing(layerNum1, false);
-        }
-      }
-    }
-    if (samenetCon) {
-      // filter rule, assuming default via will never trigger cutArea
-      auto reqSpcVal = samenetCon->getCutSpacing();
-      if (reqSpcVal == 0) {
-        ;
-      } else {
-        if (!samenetCon->hasCenterToCenter()) {
-          reqSpcVal += isCurrDirY ? (cutBox1.top() - cutBox1.bottom()) : (cutBox1.right() - cutBox1.left());
-        }
-      }
-      sol = max(sol, reqSpcVal);
-    }
-  }
-
-  return sol;
-}
-
-void FlexDR::init_via2viaMinLenNew() {
-  //bool enableOutput = false;
-  bool enableOutput = true;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum    = getDesign()->getTech()->getTopLayerNum();
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
       continue;
     }
-    vector<frCoord> via2viaMinLenTmp(8, 0);
-    via2viaMinLenNew.push_back(via2viaMinLenTmp);
-  }
-  // check prl
-  int i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
+    if (layer->getType() != frLayerTypeEnum::ROUTING) {
       continue;
     }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    via2viaMinLenNew[i][0] = max(via2viaMinLenNew[i][0], init_via2viaMinLenNew_minSpc(lNum, downVia, downVia, false));
-    via2viaMinLenNew[i][1] = max(via2viaMinLenNew[i][1], init_via2viaMinLenNew_minSpc(lNum, downVia, downVia, true ));
-    via2viaMinLenNew[i][2] = max(via2viaMinLenNew[i][2], init_via2viaMinLenNew_minSpc(lNum, downVia, upVia,   false));
-    via2viaMinLenNew[i][3] = max(via2viaMinLenNew[i][3], init_via2viaMinLenNew_minSpc(lNum, downVia, upVia,   true ));
-    via2viaMinLenNew[i][4] = max(via2viaMinLenNew[i][4], init_via2viaMinLenNew_minSpc(lNum, upVia,   downVia, false));
-    via2viaMinLenNew[i][5] = max(via2viaMinLenNew[i][5], init_via2viaMinLenNew_minSpc(lNum, upVia,   downVia, true ));
-    via2viaMinLenNew[i][6] = max(via2viaMinLenNew[i][6], init_via2viaMinLenNew_minSpc(lNum, upVia,   upVia,   false));
-    via2viaMinLenNew[i][7] = max(via2viaMinLenNew[i][7], init_via2viaMinLenNew_minSpc(lNum, upVia,   upVia,   true ));
-    if (enableOutput) {
-      cout <<"initVia2ViaMinLenNew_minSpc " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (d2d-x, d2d-y, d2u-x, d2u-y, u2d-x, u2d-y, u2u-x, u2u-y) = (" 
-           <<via2viaMinLenNew[i][0] <<", "
-           <<via2viaMinLenNew[i][1] <<", "
-           <<via2viaMinLenNew[i][2] <<", "
-           <<via2viaMinLenNew[i][3] <<", "
-           <<via2viaMinLenNew[i][4] <<", "
-           <<via2viaMinLenNew[i][5] <<", "
-           <<via2viaMinLenNew[i][6] <<", "
-           <<via2viaMinLenNew[i][7] <<")" <<endl;
-    }
-    i++;
-  }
-
-  // check minimumcut
-  i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    via2viaMinLenNew[i][0] = max(via2viaMinLenNew[i][0], init_via2viaMinLenNew_minimumcut1(lNum, downVia, downVia, false));
-    via2viaMinLenNew[i][1] = max(via2viaMinLenNew[i][1], init_via2viaMinLenNew_minimumcut1(lNum, downVia, downVia, true ));
-    via2viaMinLenNew[i][2] = max(via2viaMinLenNew[i][2], init_via2viaMinLenNew_minimumcut1(lNum, downVia, upVia,   false));
-    via2viaMinLenNew[i][3] = max(via2viaMinLenNew[i][3], init_via2viaMinLenNew_minimumcut1(lNum, downVia, upVia,   true ));
-    via2viaMinLenNew[i][4] = max(via2viaMinLenNew[i][4], init_via2viaMinLenNew_minimumcut1(lNum, upVia,   downVia, false));
-    via2viaMinLenNew[i][5] = max(via2viaMinLenNew[i][5], init_via2viaMinLenNew_minimumcut1(lNum, upVia,   downVia, true ));
-    via2viaMinLenNew[i][6] = max(via2viaMinLenNew[i][6], init_via2viaMinLenNew_minimumcut1(lNum, upVia,   upVia,   false));
-    via2viaMinLenNew[i][7] = max(via2viaMinLenNew[i][7], init_via2viaMinLenNew_minimumcut1(lNum, upVia,   upVia,   true ));
-    if (enableOutput) {
-      cout <<"initVia2ViaMinLenNew_minimumcut " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (d2d-x, d2d-y, d2u-x, d2u-y, u2d-x, u2d-y, u2u-x, u2u-y) = (" 
-           <<via2viaMinLenNew[i][0] <<", "
-           <<via2viaMinLenNew[i][1] <<", "
-           <<via2viaMinLenNew[i][2] <<", "
-           <<via2viaMinLenNew[i][3] <<", "
-           <<via2viaMinLenNew[i][4] <<", "
-           <<via2viaMinLenNew[i][5] <<", "
-           <<via2viaMinLenNew[i][6] <<", "
-           <<via2viaMinLenNew[i][7] <<")" <<endl;
-    }
-    i++;
-  }
-
-  // check cut spacing
-  i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    via2viaMinLenNew[i][0] = max(via2viaMinLenNew[i][0], init_via2viaMinLenNew_cutSpc(lNum, downVia, downVia, false));
-    via2viaMinLenNew[i][1] = max(via2viaMinLenNew[i][1], init_via2viaMinLenNew_cutSpc(lNum, downVia, downVia, true ));
-    via2viaMinLenNew[i][2] = max(via2viaMinLenNew[i][2], init_via2viaMinLenNew_cutSpc(lNum, downVia, upVia,   false));
-    via2viaMinLenNew[i][3] = max(via2viaMinLenNew[i][3], init_via2viaMinLenNew_cutSpc(lNum, downVia, upVia,   true ));
-    via2viaMinLenNew[i][4] = max(via2viaMinLenNew[i][4], init_via2viaMinLenNew_cutSpc(lNum, upVia,   downVia, false));
-    via2viaMinLenNew[i][5] = max(via2viaMinLenNew[i][5], init_via2viaMinLenNew_cutSpc(lNum, upVia,   downVia, true ));
-    via2viaMinLenNew[i][6] = max(via2viaMinLenNew[i][6], init_via2viaMinLenNew_cutSpc(lNum, upVia,   upVia,   false));
-    via2viaMinLenNew[i][7] = max(via2viaMinLenNew[i][7], init_via2viaMinLenNew_cutSpc(lNum, upVia,   upVia,   true ));
-    if (enableOutput) {
-      cout <<"initVia2ViaMinLenNew_cutSpc " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (d2d-x, d2d-y, d2u-x, d2u-y, u2d-x, u2d-y, u2u-x, u2u-y) = (" 
-           <<via2viaMinLenNew[i][0] <<", "
-           <<via2viaMinLenNew[i][1] <<", "
-           <<via2viaMinLenNew[i][2] <<", "
-           <<via2viaMinLenNew[i][3] <<", "
-           <<via2viaMinLenNew[i][4] <<", "
-           <<via2viaMinLenNew[i][5] <<", "
-           <<via2viaMinLenNew[i][6] <<", "
-           <<via2viaMinLenNew[i][7] <<")" <<endl;
-    }
-    i++;
-  }
-
-}
-
-void FlexDR::init_halfViaEncArea() {
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum    = getDesign()->getTech()->getTopLayerNum();
-  for (int i = bottomLayerNum; i <= topLayerNum; i++) {
-    if (getDesign()->getTech()->getLayer(i)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    if (i + 1 <= topLayerNum && getDesign()->getTech()->getLayer(i + 1)->getType() == frLayerTypeEnum::CUT) {
-      auto viaDef = getTech()->getLayer(i + 1)->getDefaultViaDef();
-      frVia via(viaDef);
-      frBox layer1Box;
-      frBox layer2Box;
-      via.getLayer1BBox(layer1Box);
-      via.getLayer2BBox(layer2Box);
-      auto layer1HalfArea = layer1Box.width() * layer1Box.length() / 2;
-      auto layer2HalfArea = layer2Box.width() * layer2Box.length() / 2;
-      halfViaEncArea.push_back(make_pair(layer1HalfArea, layer2HalfArea));
-    } else {
-      halfViaEncArea.push_back(make_pair(0,0));
-    }
-  }
-}
-
-
-
-frCoord FlexDR::init_via2turnMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY) {
-  if (!viaDef) {
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  bool isCurrDirX = !isCurrDirY;
-  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
-
-  frVia via1(viaDef);
-  frBox viaBox1;
-  if (viaDef->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-  } else {
-    via1.getLayer2BBox(viaBox1);
-  }
-  auto width1    = viaBox1.width();
-  bool isVia1Fat = isCurrDirX ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
-  auto prl1      = isCurrDirX ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
-
-  frCoord reqDist = 0;
-  if (isVia1Fat) {
-    auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
-    if (con) {
-      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
-        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
-        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, defaultWidth), prl1);
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
-        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, defaultWidth, prl1);
+    frCoord defaultWidth = layer->getWidth();
+    bool isH = (layer->getDir() == frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
+    if (lNum > tech->getBottomLayerNum()) {
+      info.viaDefL = tech->getLayer(lNum - 1)->getDefaultViaDef();
+    }
+    if (lNum < tech->getTopLayerNum()) {
+      info.viaDefU = tech->getLayer(lNum + 1)->getDefaultViaDef();
+    }
+    if (info.viaDefL) {
+      frVia via(info.viaDefL);
+      via.getLayer2BBox(info.viaBoxL);
+      info.isFatViaL = isH ? (info.viaBoxL.top() - info.viaBoxL.bottom() > defaultWidth) :
+                             (info.viaBoxL.right() - info.viaBoxL.left() > defaultWidth);
+    }
+    if (info.viaDefU) {
+      frVia via(info.viaDefU);
+      via.getLayer1BBox(info.viaBoxU);
+      info.isFatViaU = isH ? (info.viaBoxU.top() - info.viaBoxU.bottom() > defaultWidth) :
+                             (info.viaBoxU.right() - info.viaBoxU.left() > defaultWidth);
+    }
+    auto minAreaConstraint = layer->getAreaConstraint();
+    auto minArea           = minAreaConstraint ? minAreaConstraint->getMinArea() : 0;
+    if (defaultWidth > 0 && tech->getManufacturingGrid() > 0) {
+      info.patchLength = frCoord(ceil(1.0 * minArea / defaultWidth / tech->getManufacturingGrid())) * 
+                         frCoord(tech->getManufacturingGrid());
+    }
+    // no need to bloat eolWithin because eolWithin always < minSpacing
+    for (auto con: layer->getEolSpacing()) {
+      auto eolSpace = con->getMinSpacing();
+      auto eolWidth = con->getEolWidth();
+      if (info.viaDefL && info.viaBoxL.right() - info.viaBoxL.left() < eolWidth) {
+        info.eolBloatYL = max(info.eolBloatYL, eolSpace);
       }
-    }
-    if (isCurrDirX) {
-      reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
-      reqDist += defaultWidth;
-    } else {
-      reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
-      reqDist += defaultWidth;
-    }
-    sol = max(sol, reqDist);
-  }
-
-  return sol;
-}
-
-frCoord FlexDR::init_via2turnMinLen_minStp(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY) {
-  if (!viaDef) {
-    return 0;
-  }
-
-  frCoord sol = 0;
-
-  // check min len in lNum assuming pre dir routing
-  bool isCurrDirX = !isCurrDirY;
-  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
-
-  frVia via1(viaDef);
-  frBox viaBox1;
-  if (viaDef->getLayer1Num() == lNum) {
-    via1.getLayer1BBox(viaBox1);
-  } else {
-    via1.getLayer2BBox(viaBox1);
-  }
-  bool isVia1Fat = isCurrDirX ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
-
-  frCoord reqDist = 0;
-  if (isVia1Fat) {
-    auto con = getDesign()->getTech()->getLayer(lNum)->getMinStepConstraint();
-    if (con && con->hasMaxEdges()) { // currently only consider maxedge violation
-      reqDist = con->getMinStepLength();
-      if (isCurrDirX) {
-        reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
-        reqDist += defaultWidth;
-      } else {
-        reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
-        reqDist += defaultWidth;
+      if (info.viaDefL && info.viaBoxL.top() - info.viaBoxL.bottom() < eolWidth) {
+        info.eolBloatXL = max(info.eolBloatXL, eolSpace);
+      }
+      if (info.viaDefU && info.viaBoxU.right() - info.viaBoxU.left() < eolWidth) {
+        info.eolBloatYU = max(info.eolBloatYU, eolSpace);
+      }
+      if (info.viaDefU && info.viaBoxU.top() - info.viaBoxU.bottom() < eolWidth) {
+        info.eolBloatXU = max(info.eolBloatXU, eolSpace);
       }
-      sol = max(sol, reqDist);
-    }
-  }
-  return sol;
-}
-
-
-void FlexDR::init_via2turnMinLen() {
-  bool enableOutput = false;
-  //bool enableOutput = true;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum    = getDesign()->getTech()->getTopLayerNum();
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    vector<frCoord> via2turnMinLenTmp(4, 0);
-    via2turnMinLen.push_back(via2turnMinLenTmp);
-  }
-  // check prl
-  int i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    via2turnMinLen[i][0] = max(via2turnMinLen[i][0], init_via2turnMinLen_minSpc(lNum, downVia, false));
-    via2turnMinLen[i][1] = max(via2turnMinLen[i][1], init_via2turnMinLen_minSpc(lNum, downVia, true));
-    via2turnMinLen[i][2] = max(via2turnMinLen[i][2], init_via2turnMinLen_minSpc(lNum, upVia, false));
-    via2turnMinLen[i][3] = max(via2turnMinLen[i][3], init_via2turnMinLen_minSpc(lNum, upVia, true));
-    if (enableOutput) {
-      cout <<"initVia2TurnMinLen_minSpc " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (down->x->y, down->y->x, up->x->y, up->y->x) = (" 
-           <<via2turnMinLen[i][0] <<", "
-           <<via2turnMinLen[i][1] <<", "
-           <<via2turnMinLen[i][2] <<", "
-           <<via2turnMinLen[i][3] <<")" <<endl;
-    }
-    i++;
-  }
-
-  // check minstep
-  i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia   = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    vector<frCoord> via2turnMinLenTmp(4, 0);
-    via2turnMinLen[i][0] = max(via2turnMinLen[i][0], init_via2turnMinLen_minStp(lNum, downVia, false));
-    via2turnMinLen[i][1] = max(via2turnMinLen[i][1], init_via2turnMinLen_minStp(lNum, downVia, true));
-    via2turnMinLen[i][2] = max(via2turnMinLen[i][2], init_via2turnMinLen_minStp(lNum, upVia, false));
-    via2turnMinLen[i][3] = max(via2turnMinLen[i][3], init_via2turnMinLen_minStp(lNum, upVia, true));
-    if (enableOutput) {
-      cout <<"initVia2TurnMinLen_minstep " <<getDesign()->getTech()->getLayer(lNum)->getName()
-           <<" (down->x->y, down->y->x, up->x->y, up->y->x) = (" 
-           <<via2turnMinLen[i][0] <<", "
-           <<via2turnMinLen[i][1] <<", "
-           <<via2turnMinLen[i][2] <<", "
-           <<via2turnMinLen[i][3] <<")" <<endl;
     }
-    i++;
-  }
-}
-
-
-
-void FlexDR::init() {
-  ProfileTask profile("DR:init");
-  frTime t;
-  if (VERBOSE > 0) {
-    cout <<endl <<"start routing data preparation" <<endl;
-  }
-  initGCell2BoundaryPin();
-  getRegionQuery()->initDRObj(getTech()->getLayers().size()); // first init in postProcess
-
-  init_halfViaEncArea();
-  init_via2viaMinLen();
-  init_via2viaMinLenNew();
-  init_via2turnMinLen();
-
-  if (VERBOSE > 0) {
-    t.print();
   }
 }
 
@@ -1484,13 +658,14 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
   std::string profile_name("DR:searchRepair");
   profile_name += std::to_string(iter);
   ProfileTask profile(profile_name.c_str());
-  if (iter > END_ITERATION) {
+  if (iter > END_ITERATION || iter < startIter) {
     return;
   }
-  if (ripupMode != 1 && getDesign()->getTopBlock()->getMarkers().size() == 0) {
+  if (ripupMode != 1 && ripupMode != 3 && getDesign()->getTopBlock()->getMarkers().size() == 0) {
     return;
   } 
 
+  frMetrics metrics("dr_iter", iter);
   frTime t;
   //bool TEST = false;
   //bool TEST = true;
@@ -1519,6 +694,11 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
   int tot = (((int)xgp.getCount() - 1 - offset) / clipSize + 1) * (((int)ygp.getCount() - 1 - offset) / clipSize + 1);
   int prev_perc = 0;
   bool isExceed = false;
+  unsigned long long numNodesExpanded = 0;
+  int numRoutedNets = 0;
+  vector<drWorkerStat> workerStats;
+  vector<double> batchTimes;
+  vector<drNumaStat> numaStats;
   if (TEST) {
     cout <<"search and repair test mode" <<endl <<flush;
     //FlexDRWorker worker(getDesign());
@@ -1563,6 +743,8 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
     worker.setCost(workerDRCCost, workerMarkerCost, workerMarkerBloatWidth, workerMarkerBloatDepth);
     worker.main_mt();
     numQuickMarkers += worker.getNumQuickMarkers();
+    numNodesExpanded += worker.getNumNodesExpanded();
+    numRoutedNets += worker.getNumRoutedNets();
     cout <<"done"  <<endl <<flush;
   } else {
 
@@ -1583,6 +765,11 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
         getDesign()->getTopBlock()->getGCellBox(frPoint(min((int)xgp.getCount() - 1, i + clipSize-1), 
                                                         min((int)ygp.getCount(), j + clipSize-1)), routeBox2);
         frBox routeBox(routeBox1.left(), routeBox1.bottom(), routeBox2.right(), routeBox2.top());
+        // the eco pass only needs the clips the changed nets go through
+        if (ripupMode == 3 && !isEcoClip(routeBox)) {
+          yIdx++;
+          continue;
+        }
         frBox extBox;
         frBox drcBox;
         routeBox.bloat(MTSAFEDIST, extBox);
@@ -1620,37 +807,56 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
 
 
     omp_set_num_threads(MAX_THREADS);
+    if (DR_NUMA && !numa) {
+      numa = make_unique<frNuma>();
+    }
+
+    // called under omp critical when a worker is done
+    auto workerDone = [&](FlexDRWorker* worker) {
+      cnt++;
+      numNodesExpanded += worker->getNumNodesExpanded();
+      numRoutedNets += worker->getNumRoutedNets();
+      if (VERBOSE > 0) {
+        if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
+          if (prev_perc == 0 && t.isExceed(0)) {
+            isExceed = true;
+          }
+          prev_perc += 10;
+          //if (true) {
+          if (isExceed) {
+            if (enableDRC) {
+              cout <<"    completing " <<prev_perc <<"% with " <<getDesign()->getTopBlock()->getNumMarkers() <<" violations" <<endl;
+            } else {
+              cout <<"    completing " <<prev_perc <<"% with " <<numQuickMarkers <<" quick violations" <<endl;
+            }
+            cout <<"    " <<t <<endl <<flush;
+          }
+        }
+      }
+    };
 
     // parallel execution
     for (auto &workerBatch: workers) {
       ProfileTask profile("DR:checkerboard");
       for (auto &workersInBatch: workerBatch) {
+        auto batchT0 = std::chrono::high_resolution_clock::now();
         {
           ProfileTask profile("DR:batch");
-          // multi thread
-          #pragma omp parallel for schedule(dynamic)
-          for (int i = 0; i < (int)workersInBatch.size(); i++) {
-            workersInBatch[i]->main_mt();
-            #pragma omp critical 
-            {
-              cnt++;
-              if (VERBOSE > 0) {
-                if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
-                  if (prev_perc == 0 && t.isExceed(0)) {
-                    isExceed = true;
-                  }
-                  prev_perc += 10;
-                  //if (true) {
-                  if (isExceed) {
-                    if (enableDRC) {
-                      cout <<"    completing " <<prev_perc <<"% with " <<getDesign()->getTopBlock()->getNumMarkers() <<" violations" <<endl;
-                    } else {
-                      cout <<"    completing " <<prev_perc <<"% with " <<numQuickMarkers <<" quick violations" <<endl;
-                    }
-                    cout <<"    " <<t <<endl <<flush;
-                  }
-                }
-              }
+          if (!distFds.empty()) {
+            // routed by the worker processes
+            dist_runBatch(workersInBatch);
+            for (auto &worker: workersInBatch) {
+              workerDone(worker.get());
+            }
+          } else if (DR_NUMA) {
+            searchRepair_numaBatch(workersInBatch, numaStats, workerDone);
+          } else {
+            // multi thread
+            #pragma omp parallel for schedule(dynamic)
+            for (int i = 0; i < (int)workersInBatch.size(); i++) {
+              workersInBatch[i]->main_mt();
+              #pragma omp critical 
+              workerDone(workersInBatch[i].get());
             }
           }
         }
@@ -1659,9 +865,17 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
           // single thread
           for (int i = 0; i < (int)workersInBatch.size(); i++) {
             workersInBatch[i]->end();
+            if (DR_WORKER_REPORT > 0) {
+              workerStats.push_back(workersInBatch[i]->getStat());
+              workerStats.back().batchIdx = batchTimes.size();
+            }
           }
           workersInBatch.clear();
         }
+        if (DR_WORKER_REPORT > 0) {
+          auto batchT1 = std::chrono::high_resolution_clock::now();
+          batchTimes.push_back(std::chrono::duration<double>(batchT1 - batchT0).count());
+        }
       }
     }
   }
@@ -1685,8 +899,22 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
       }
     }
   }
+  if (VERBOSE > 0 && DR_WORKER_REPORT > 0 && !workerStats.empty()) {
+    reportWorkerStats(iter, workerStats, batchTimes);
+  }
+  if (VERBOSE > 0 && !numaStats.empty()) {
+    reportNumaStats(iter, numaStats);
+  }
   checkConnectivity(iter);
+  dist_endIter(iter);
   numViols.push_back(getDesign()->getTopBlock()->getNumMarkers());
+  double markerArea = 0;
+  for (auto &marker: getDesign()->getTopBlock()->getMarkers()) {
+    frBox box;
+    marker->getBBox(box);
+    markerArea += (double)box.width() * box.length();
+  }
+  markerAreas.push_back(markerArea);
   if (VERBOSE > 0) {
     if (enableDRC) {
       cout <<"  number of violations = " <<getDesign()->getTopBlock()->getNumMarkers() <<endl;
@@ -1696,9 +924,148 @@ void FlexDR::searchRepair(int iter, int size, int offset, int mazeEndIter,
     t.print();
     cout <<flush;
   }
+  metrics.add("workers", TEST ? 1 : tot);
+  metrics.add("markers", getDesign()->getTopBlock()->getNumMarkers());
+  metrics.add("nodes_expanded", numNodesExpanded);
+  metrics.add("nets_rerouted", numRoutedNets);
+  for (int i = 0; i < (int)numaStats.size(); i++) {
+    auto prefix = "numa" + to_string(i) + "_";
+    metrics.add(prefix + "workers", numaStats[i].numWorkers);
+    metrics.add(prefix + "stolen", numaStats[i].numStolen);
+    metrics.add(prefix + "worker_ms", (long long)(numaStats[i].time * 1000));
+    metrics.add(prefix + "nodes_expanded", numaStats[i].numExpanded);
+  }
   end();
 }
 
+// prints the DR_WORKER_REPORT slowest workers and a runtime histogram of every batch;
+// a batch only finishes with its slowest worker
+void FlexDR::reportWorkerStats(int iter, vector<drWorkerStat> &stats, const vector<double> &batchTimes) {
+  boost::io::ios_all_saver guard(std::cout);
+  auto dbu = getTech()->getDBUPerUU();
+  auto totTime = [](const drWorkerStat &stat) {
+    return stat.initTime + stat.routeTime + stat.postTime;
+  };
+  cout <<"  worker report of iteration " <<iter <<": " <<stats.size() <<" workers in "
+       <<batchTimes.size() <<" batches" <<endl;
+  cout <<fixed <<setprecision(3);
+
+  int numTop = min((int)stats.size(), DR_WORKER_REPORT);
+  partial_sort(stats.begin(), stats.begin() + numTop, stats.end(),
+               [&totTime](const drWorkerStat &a, const drWorkerStat &b) {
+                 return totTime(a) > totTime(b);
+               });
+  cout <<"    slowest workers, seconds (INIT/ROUTE/POST)" <<endl;
+  for (int i = 0; i < numTop; i++) {
+    auto &stat = stats[i];
+    cout <<"      " <<totTime(stat) <<" (" <<stat.initTime <<"/" <<stat.routeTime <<"/" <<stat.postTime <<")"
+         <<" box ( " <<stat.routeBox.left()  * 1.0 / dbu <<" " <<stat.routeBox.bottom() * 1.0 / dbu <<" ) ( "
+         <<stat.routeBox.right() * 1.0 / dbu <<" " <<stat.routeBox.top()    * 1.0 / dbu <<" )"
+         <<" batch " <<stat.batchIdx <<", " <<stat.numNets <<" nets, grid "
+         <<stat.xDim <<"x" <<stat.yDim <<"x" <<stat.zDim <<", " <<stat.numExpanded <<" nodes expanded" <<endl;
+  }
+
+  // 1-2-5 buckets, upper bounds in seconds
+  const vector<double> bounds = {0.01, 0.02, 0.05, 0.1, 0.2, 0.5, 1, 2, 5, 10, 20, 50, 100, 200, 500};
+  vector<vector<int> > hist(batchTimes.size(), vector<int>(bounds.size() + 1, 0));
+  vector<double> maxTime(batchTimes.size(), 0);
+  vector<double> sumTime(batchTimes.size(), 0);
+  vector<int> cnt(batchTimes.size(), 0);
+  for (auto &stat: stats) {
+    double time = totTime(stat);
+    int bucket = upper_bound(bounds.begin(), bounds.end(), time) - bounds.begin();
+    hist[stat.batchIdx][bucket]++;
+    maxTime[stat.batchIdx] = max(maxTime[stat.batchIdx], time);
+    sumTime[stat.batchIdx] += time;
+    cnt[stat.batchIdx]++;
+  }
+  cout <<"    batch runtime, seconds (wall, slowest / mean worker) and workers per bucket" <<endl;
+  for (int i = 0; i < (int)batchTimes.size(); i++) {
+    if (cnt[i] == 0) {
+      continue;
+    }
+    cout <<"      batch " <<i <<": " <<batchTimes[i] <<", " <<maxTime[i] <<" / " <<sumTime[i] / cnt[i] <<" |";
+    for (int j = 0; j < (int)hist[i].size(); j++) {
+      if (hist[i][j] == 0) {
+        continue;
+      }
+      if (j < (int)bounds.size()) {
+        cout <<" <" <<defaultfloat <<bounds[j] <<":" <<hist[i][j];
+      } else {
+        cout <<" >=" <<defaultfloat <<bounds.back() <<":" <<hist[i][j];
+      }
+      cout <<fixed;
+    }
+    cout <<endl;
+  }
+  cout <<flush;
+}
+
+// workers of a batch are in x-major order, so a contiguous index range is a
+// vertical stripe of clips; every NUMA node gets one stripe for its threads,
+// which move on to the stripes of other nodes only when their own is done
+void FlexDR::searchRepair_numaBatch(vector<unique_ptr<FlexDRWorker> > &workersInBatch,
+                                    vector<drNumaStat> &numaStats, const function<void(FlexDRWorker*)> &workerDone) {
+  int numWorkers = workersInBatch.size();
+  int numNodes = min(numa->getNumNodes(), MAX_THREADS);
+  if (numaStats.empty()) {
+    numaStats.resize(numNodes, drNumaStat{0, 0, 0, 0});
+  }
+  vector<int> stripeEnd(numNodes);
+  auto next = make_unique<atomic<int>[]>(numNodes);
+  for (int i = 0; i < numNodes; i++) {
+    next[i] = (long long)numWorkers * i / numNodes;
+    stripeEnd[i] = (long long)numWorkers * (i + 1) / numNodes;
+  }
+  atomic<int> numUnbound(0);
+  #pragma omp parallel
+  {
+    // threads are split over the nodes in order; an unbound thread still
+    // routes its stripe, only without the memory locality
+    int node = omp_get_thread_num() * numNodes / omp_get_num_threads();
+    cpu_set_t prevMask;
+    bool isBound = numa->bindThread(node, prevMask);
+    if (!isBound) {
+      numUnbound++;
+    }
+    for (int k = 0; k < numNodes; k++) {
+      int stripe = (node + k) % numNodes;
+      for (int i = next[stripe]++; i < stripeEnd[stripe]; i = next[stripe]++) {
+        auto worker = workersInBatch[i].get();
+        worker->main_mt();
+        #pragma omp critical 
+        {
+          auto &stat = worker->getStat();
+          numaStats[node].numWorkers++;
+          numaStats[node].numStolen += (stripe != node);
+          numaStats[node].time += stat.initTime + stat.routeTime + stat.postTime;
+          numaStats[node].numExpanded += stat.numExpanded;
+          workerDone(worker);
+        }
+      }
+    }
+    // omp reuses its threads for the rest of the run, which is not NUMA aware
+    if (isBound && !numa->restoreThread(prevMask)) {
+      numUnbound++;
+    }
+  }
+  if (numUnbound > 0 && VERBOSE > 0) {
+    cout <<"Warning: failed to bind or unbind " <<numUnbound <<" DR threads to their NUMA node" <<endl;
+  }
+}
+
+void FlexDR::reportNumaStats(int iter, const vector<drNumaStat> &numaStats) {
+  boost::io::ios_all_saver guard(std::cout);
+  cout <<"  numa report of iteration " <<iter <<", workers (stolen), seconds, nodes expanded" <<endl;
+  cout <<fixed <<setprecision(3);
+  for (int i = 0; i < (int)numaStats.size(); i++) {
+    auto &stat = numaStats[i];
+    cout <<"    node " <<numa->getNodeId(i) <<": " <<stat.numWorkers <<" (" <<stat.numStolen <<"), "
+         <<stat.time <<", " <<stat.numExpanded <<endl;
+  }
+  cout <<flush;
+}
+
 void FlexDR::end() {
   vector<unsigned long long> wlen(getTech()->getLayers().size(), 0);
   vector<unsigned long long> sCut(getTech()->getLayers().size(), 0);
@@ -1909,9 +1276,57 @@ void FlexDR::reportDRC() {
 }
 
 
+bool FlexDR::isSameCostStep(const frDRIterParam &a, const frDRIterParam &b) {
+  return a.mazeEndIter == b.mazeEndIter && a.drcCost == b.drcCost && a.markerCost == b.markerCost &&
+         a.ripupMode == b.ripupMode && a.followGuide == b.followGuide;
+}
+
+// decides from the violation count and marker area history whether
+// search and repair still converges
+FlexDR::stallAction FlexDR::getStallAction() {
+  int numIters = numViols.size();
+  if (DR_STOP_VIOLATIONS >= 0 && numViols.back() <= DR_STOP_VIOLATIONS) {
+    if (VERBOSE > 0) {
+      cout <<"  stop search and repair at " <<numViols.back() <<" violations" <<endl;
+    }
+    return STOP;
+  }
+  // markerAreas only covers the iterations run by this process (restart)
+  int window = DR_STALL_WINDOW;
+  if (window <= 0 || (int)markerAreas.size() <= window || numIters - lastStallIter <= window) {
+    return CONTINUE;
+  }
+  double ratio = 1.0 - DR_STALL_IMPROVEMENT;
+  bool isViolStall = numViols.back() > numViols[numIters - 1 - window] * ratio;
+  bool isAreaStall = markerAreas.back() > markerAreas[markerAreas.size() - 1 - window] * ratio;
+  if (!isViolStall || !isAreaStall) {
+    return CONTINUE;
+  }
+  lastStallIter = numIters;
+  if (VERBOSE > 0) {
+    cout <<"  violations stalled at " <<numViols.back() <<" over the last " <<window
+         <<" iterations, policy " <<DR_STALL_POLICY <<endl;
+  }
+  if (DR_STALL_POLICY == "skip") {
+    return SKIP;
+  } else if (DR_STALL_POLICY == "escalate") {
+    return ESCALATE;
+  }
+  return STOP; // "stop", main() rejects any other policy
+}
+
 int FlexDR::main() {
   ProfileTask profile("DR:main");
   init();
+  // worker processes of a distributed run only route what the leader sends
+  if (DR_DIST_LEADER != "" && ecoNets.empty()) {
+    dist_serve();
+    return 0;
+  }
+  if (DR_STALL_POLICY != "stop" && DR_STALL_POLICY != "skip" && DR_STALL_POLICY != "escalate") {
+    cout <<"Error: unknown drouteStallPolicy " <<DR_STALL_POLICY <<endl;
+    exit(1);
+  }
   frTime t;
   if (VERBOSE > 0) {
     cout <<endl <<endl <<"start detail routing ...";
@@ -1933,73 +1348,141 @@ int FlexDR::main() {
 
   // need three different offsets to resolve boundary corner issues
 
-  int iterNum = 0;
-  searchRepair(iterNum++/*  0 */,  7,  0, 3, DRCCOST, 0/*MAARKERCOST*/,  0, 0, true, 1, true, 9); // true search and repair
-  searchRepair(iterNum++/*  1 */,  7, -2, 3, DRCCOST, DRCCOST/*MAARKERCOST*/,  0, 0, true, 1, true, 9); // true search and repair
-  searchRepair(iterNum++/*  1 */,  7, -5, 3, DRCCOST, DRCCOST/*MAARKERCOST*/,  0, 0, true, 1, true, 9); // true search and repair
-  searchRepair(iterNum++/*  3 */,  7,  0, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/*  4 */,  7, -1, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/*  5 */,  7, -2, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/*  6 */,  7, -3, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/*  7 */,  7, -4, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/*  8 */,  7, -5, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/*  9 */,  7, -6, 8, DRCCOST, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 10 */,  7,  0, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 11 */,  7, -1, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 12 */,  7, -2, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 13 */,  7, -3, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 14 */,  7, -4, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 15 */,  7, -5, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 16 */,  7, -6, 8, DRCCOST*2, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* ra'*/,  7, -3, 8, DRCCOST, MARKERCOST,  0, 0, true, 1, false, 9); // true search and repair
-  searchRepair(iterNum++/* 17 */,  7,  0, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 18 */,  7, -1, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 19 */,  7, -2, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 20 */,  7, -3, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 21 */,  7, -4, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 22 */,  7, -5, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 23 */,  7, -6, 8, DRCCOST*4, MARKERCOST,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* ra'*/,  5, -2, 8, DRCCOST, MARKERCOST,  0, 0, true, 1, false, 9); // true search and repair
-  searchRepair(iterNum++/* 24 */,  7,  0, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 25 */,  7, -1, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 26 */,  7, -2, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 27 */,  7, -3, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 28 */,  7, -4, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 29 */,  7, -5, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 30 */,  7, -6, 8, DRCCOST*8, MARKERCOST*2,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* ra'*/,  3, -1, 8, DRCCOST, MARKERCOST,  0, 0, true, 1, false, 9); // true search and repair
-  searchRepair(iterNum++/* 31 */,  7,  0, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 32 */,  7, -1, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 33 */,  7, -2, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 34 */,  7, -3, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 35 */,  7, -4, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 36 */,  7, -5, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 37 */,  7, -6, 8, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* ra'*/,  3, -2, 8, DRCCOST, MARKERCOST,  0, 0, true, 1, false, 9); // true search and repair
-  searchRepair(iterNum++/* 38 */,  7,  0, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 39 */,  7, -1, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 40 */,  7, -2, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 41 */,  7, -3, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 42 */,  7, -4, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 43 */,  7, -5, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 44 */,  7, -6, 16, DRCCOST*16, MARKERCOST*4,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* ra'*/,  3, -0, 8, DRCCOST, MARKERCOST,  0, 0, true, 1, false, 9); // true search and repair
-  searchRepair(iterNum++/* 45 */,  7,  0, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 46 */,  7, -1, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 47 */,  7, -2, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 48 */,  7, -3, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 49 */,  7, -4, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 50 */,  7, -5, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 51 */,  7, -6, 32, DRCCOST*32, MARKERCOST*8,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* ra'*/,  3, -1, 8, DRCCOST, MARKERCOST,  0, 0, true, 1, false, 9); // true search and repair
-  searchRepair(iterNum++/* 52 */,  7,  0, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 53 */,  7, -1, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 54 */,  7, -2, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 55 */,  7, -3, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 56 */,  7, -4, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 57 */,  7, -5, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
-  searchRepair(iterNum++/* 58 */,  7, -6, 64, DRCCOST*64, MARKERCOST*16,  0, 0, true, 0, false, 9); // true search and repair
+  // size, offset, mazeEndIter, workerDRCCost, workerMarkerCost, ripupMode, followGuide
+  // (markerBloatWidth/Depth = 0, enableDRC = true, fixMode = 9); drouteIter lines in
+  // the param file replace this schedule
+  vector<frDRIterParam> schedule = {
+    { 7,  0,  3, DRCCOST,    0,             1, true }, //  0
+    { 7, -2,  3, DRCCOST,    DRCCOST,       1, true }, //  1
+    { 7, -5,  3, DRCCOST,    DRCCOST,       1, true }, //  1
+    { 7,  0,  8, DRCCOST,    MARKERCOST,    0, false}, //  3
+    { 7, -1,  8, DRCCOST,    MARKERCOST,    0, false}, //  4
+    { 7, -2,  8, DRCCOST,    MARKERCOST,    0, false}, //  5
+    { 7, -3,  8, DRCCOST,    MARKERCOST,    0, false}, //  6
+    { 7, -4,  8, DRCCOST,    MARKERCOST,    0, false}, //  7
+    { 7, -5,  8, DRCCOST,    MARKERCOST,    0, false}, //  8
+    { 7, -6,  8, DRCCOST,    MARKERCOST,    0, false}, //  9
+    { 7,  0,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 10
+    { 7, -1,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 11
+    { 7, -2,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 12
+    { 7, -3,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 13
+    { 7, -4,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 14
+    { 7, -5,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 15
+    { 7, -6,  8, DRCCOST*2,  MARKERCOST,    0, false}, // 16
+    { 7, -3,  8, DRCCOST,    MARKERCOST,    1, false}, // ra'
+    { 7,  0,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 17
+    { 7, -1,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 18
+    { 7, -2,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 19
+    { 7, -3,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 20
+    { 7, -4,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 21
+    { 7, -5,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 22
+    { 7, -6,  8, DRCCOST*4,  MARKERCOST,    0, false}, // 23
+    { 5, -2,  8, DRCCOST,    MARKERCOST,    1, false}, // ra'
+    { 7,  0,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 24
+    { 7, -1,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 25
+    { 7, -2,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 26
+    { 7, -3,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 27
+    { 7, -4,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 28
+    { 7, -5,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 29
+    { 7, -6,  8, DRCCOST*8,  MARKERCOST*2,  0, false}, // 30
+    { 3, -1,  8, DRCCOST,    MARKERCOST,    1, false}, // ra'
+    { 7,  0,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 31
+    { 7, -1,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 32
+    { 7, -2,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 33
+    { 7, -3,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 34
+    { 7, -4,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 35
+    { 7, -5,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 36
+    { 7, -6,  8, DRCCOST*16, MARKERCOST*4,  0, false}, // 37
+    { 3, -2,  8, DRCCOST,    MARKERCOST,    1, false}, // ra'
+    { 7,  0, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 38
+    { 7, -1, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 39
+    { 7, -2, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 40
+    { 7, -3, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 41
+    { 7, -4, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 42
+    { 7, -5, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 43
+    { 7, -6, 16, DRCCOST*16, MARKERCOST*4,  0, false}, // 44
+    { 3, -0,  8, DRCCOST,    MARKERCOST,    1, false}, // ra'
+    { 7,  0, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 45
+    { 7, -1, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 46
+    { 7, -2, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 47
+    { 7, -3, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 48
+    { 7, -4, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 49
+    { 7, -5, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 50
+    { 7, -6, 32, DRCCOST*32, MARKERCOST*8,  0, false}, // 51
+    { 3, -1,  8, DRCCOST,    MARKERCOST,    1, false}, // ra'
+    { 7,  0, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 52
+    { 7, -1, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 53
+    { 7, -2, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 54
+    { 7, -3, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 55
+    { 7, -4, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 56
+    { 7, -5, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 57
+    { 7, -6, 64, DRCCOST*64, MARKERCOST*16, 0, false}, // 58
+  };
+  if (!DR_SCHEDULE.empty()) {
+    schedule = DR_SCHEDULE;
+  }
+  // eco: route the changed nets from their guides, then only repair markers,
+  // the full rip-up passes would reroute every net
+  if (!ecoNets.empty()) {
+    vector<frDRIterParam> ecoSchedule = {
+      { 7,  0,  3, DRCCOST,    0,             3, true },
+    };
+    for (auto &param: schedule) {
+      if (param.ripupMode == 0) {
+        ecoSchedule.push_back(param);
+      }
+    }
+    schedule = ecoSchedule;
+  }
+
+  // escalation never takes a cost above the highest one of the schedule, the
+  // maze sums frUInt4 costs times edge lengths and is only tuned up to there
+  frUInt4 maxCost = 0;
+  for (auto &param: schedule) {
+    maxCost = max({maxCost, param.drcCost, param.markerCost});
+  }
+  auto scaleCost = [&](frUInt4 cost) {
+    return (frUInt4)min((uint64_t)cost * costScale, (uint64_t)maxCost);
+  };
+  for (int iterNum = 0; iterNum < (int)schedule.size(); iterNum++) {
+    auto &param = schedule[iterNum];
+    int numIters = numViols.size();
+    searchRepair(iterNum, param.size, param.offset, param.mazeEndIter, scaleCost(param.drcCost),
+                 scaleCost(param.markerCost), 0, 0, true, param.ripupMode, param.followGuide, 9); // true search and repair
+    if ((int)numViols.size() == numIters) {
+      continue; // skipped
+    }
+    bool isCheckpointIter = DR_CHECKPOINT_FILE != "" && DR_CHECKPOINT_INTERVAL > 0 &&
+                            (iterNum + 1) % DR_CHECKPOINT_INTERVAL == 0 && ecoNets.empty();
+    auto action = getStallAction();
+    if (action == SKIP) {
+      // drop the remaining offsets of the current cost step
+      while (iterNum + 1 < (int)schedule.size() && isSameCostStep(param, schedule[iterNum + 1])) {
+        iterNum++;
+      }
+    } else if (action == ESCALATE) {
+      if ((uint64_t)costScale * 2 * max({param.drcCost, param.markerCost, 1u}) <= maxCost) {
+        costScale *= 2;
+      } else if (VERBOSE > 0) {
+        cout <<"  costs are at the limit of " <<maxCost <<", not escalating" <<endl;
+      }
+    }
+    // after the stall action, so a restart resumes with the same schedule
+    // position and cost scale
+    if (isCheckpointIter) {
+      writeCheckpoint(iterNum);
+      // query results come in tree order: the incremental updates of this run
+      // left other trees than the bulk load of a restart, so rebuild them the
+      // way a restart does and both runs route the same from here
+      getRegionQuery()->initDRObj(getTech()->getLayers().size());
+      getRegionQuery()->initMarker(getTech()->getLayers().size());
+    }
+    if (action == STOP) {
+      break;
+    }
+  }
 
+  dist_end();
   if (DRC_RPT_FILE != string("")) {
     reportDRC();
   }
@@ -30,20 +30,69 @@
 #define _FR_FLEXDR_H_
 
 #include <memory>
+#include <functional>
 #include "frDesign.h"
 #include "db/drObj/drNet.h"
 #include "db/drObj/drMarker.h"
 #include "dr/FlexGridGraph.h"
 #include "dr/FlexWavefront.h"
+#include "db/infra/frNuma.h"
+#include "dr/FlexDRRecords.h"
 #include <deque>
 
 namespace fr {
 
 
+  // runtime profile of one DR worker, see FlexDR::reportWorkerStats
+  struct drWorkerStat {
+    frBox              routeBox;
+    int                batchIdx;
+    int                numNets;
+    frMIdx             xDim;
+    frMIdx             yDim;
+    frMIdx             zDim;
+    unsigned long long numExpanded;
+    double             initTime;
+    double             routeTime;
+    double             postTime;
+  };
+
+  // DR workers run by the threads of one NUMA node in an iteration
+  struct drNumaStat {
+    int                numWorkers;
+    int                numStolen;   // taken from the stripe of another node
+    double             time;        // sum of worker runtimes
+    unsigned long long numExpanded;
+  };
+
+  // per-layer default via shapes and the bloats derived from them for the
+  // maze cost updates; built once in FlexDR::init, read-only for workers
+  struct drLayerCostInfo {
+    // routing layer
+    frViaDef*          viaDefL;     // default via from the layer below
+    frViaDef*          viaDefU;     // default via to the layer above
+    frBox              viaBoxL;     // layer2 bbox of viaDefL
+    frBox              viaBoxU;     // layer1 bbox of viaDefU
+    bool               isFatViaL;
+    bool               isFatViaU;
+    frCoord            patchLength; // min area patch at default width
+    frCoord            eolBloatXL;  // other obj eol spacing to curr obj
+    frCoord            eolBloatYL;
+    frCoord            eolBloatXU;
+    frCoord            eolBloatYU;
+    // cut layer
+    frViaDef*          cutViaDef;   // default via of this cut layer
+    frBox              cutBox;
+    std::vector<frBox> cutFigBoxes;
+    frCoord            cutBloat;
+    frCoord            cutBloatBlockage;
+  };
+
+  class FlexDRWorker;
   class FlexDR {
   public:
     // constructors
-    FlexDR(frDesign* designIn): design(designIn) {}
+    FlexDR(frDesign* designIn): design(designIn), startIter(0), lastStallIter(0), costScale(1) {}
     // getters
     frTechObject* getTech() const {
       return design->getTech();
@@ -54,69 +103,66 @@ namespace fr {
     frRegionQuery* getRegionQuery() const {
       return design->getRegionQuery();
     }
-    // others
-    int main();
-    const std::vector<std::pair<frCoord, frCoord> >* getHalfViaEncArea() const {
-      return &halfViaEncArea;
-    }
-    const std::vector<std::pair<std::vector<frCoord>, std::vector<bool> > >* getVia2ViaMinLen() const {
-      return &via2viaMinLen;
+    const drLayerCostInfo& getLayerCostInfo(frLayerNum lNum) const {
+      return layerCostInfos[lNum];
     }
-    const std::vector<std::vector<frCoord> >* getVia2ViaMinLenNew() const {
-      return &via2viaMinLenNew;
+    // an incremental run reroutes these nets only and keeps all others
+    void setEcoNets(const std::set<frNet*, frBlockObjectComp> &in) {
+      ecoNets = in;
     }
-    const std::vector<std::vector<frCoord> >* getVia2TurnMinLen() const {
-      return &via2turnMinLen;
+    bool isEcoNet(frNet* net) const {
+      return ecoNets.find(net) != ecoNets.end();
     }
+    // others
+    int main();
   protected:
     frDesign*          design;
+    std::vector<drLayerCostInfo> layerCostInfos;
+    std::set<frNet*, frBlockObjectComp> ecoNets;
+    std::unique_ptr<frNuma>      numa; // DR_NUMA only
+    std::unique_ptr<ckptIndex>   distIndex;   // distributed DR only
+    std::vector<int>             distFds;     // leader: one per worker process, worker: the leader
+    std::vector<int>             distThreads; // threads of each worker process
     std::vector<std::vector<std::map<frNet*, std::set<std::pair<frPoint, frLayerNum> >, frBlockObjectComp> > > gcell2BoundaryPin;
 
-    std::vector<std::pair<frCoord, frCoord> >  halfViaEncArea; // std::pair<layer1area, layer2area>
-    // via2viaMinLen[z][0], last via is down, curr via is down
-    // via2viaMinLen[z][1], last via is down, curr via is up
-    // via2viaMinLen[z][2], last via is up, curr via is down
-    // via2viaMinLen[z][3], last via is up, curr via is up
-    std::vector<std::pair<std::vector<frCoord>, std::vector<bool> > > via2viaMinLen;
-    
-    // via2viaMinLen[z][0], prev via is down, curr via is down, min required x dist
-    // via2viaMinLen[z][1], prev via is down, curr via is down, min required y dist
-    // via2viaMinLen[z][2], prev via is down, curr via is up,   min required x dist
-    // via2viaMinLen[z][3], prev via is down, curr via is up,   min required y dist
-    // via2viaMinLen[z][4], prev via is up,   curr via is down, min required x dist
-    // via2viaMinLen[z][5], prev via is up,   curr via is down, min required y dist
-    // via2viaMinLen[z][6], prev via is up,   curr via is up,   min required x dist
-    // via2viaMinLen[z][7], prev via is up,   curr via is up,   min required y dist
-    std::vector<std::vector<frCoord> > via2viaMinLenNew;
-
-    // via2turnMinLen[z][0], last via is down, min required x dist
-    // via2turnMinLen[z][1], last via is down, min required y dist
-    // via2turnMinLen[z][2], last via is up,   min required x dist
-    // via2turnMinLen[z][3], last via is up,   min required y dist
-    std::vector<std::vector<frCoord> > via2turnMinLen;
-
     std::vector<int>                   numViols;
+    int                                startIter; // searchRepair skips earlier iterations (restart)
+    std::vector<double>                markerAreas;
+    int                                lastStallIter; // numViols size at the last stall action
+    frUInt4                            costScale; // of the schedule costs, doubled by escalation
+
+    // convergence control between searchRepair iterations
+    enum stallAction {
+      CONTINUE = 0,
+      STOP,
+      SKIP,
+      ESCALATE
+    };
 
     // others
     void init();
     void initFromTA();
+    void initLayerCostInfo();
+    stallAction getStallAction();
+    bool isSameCostStep(const frDRIterParam &a, const frDRIterParam &b);
+    // checkpoint
+    uint64_t checkpoint_getKey();
+    void writeCheckpoint(int iter);
+    int readCheckpoint(const std::string &fileName);
     void initGCell2BoundaryPin();
+    bool isEcoClip(const frBox &routeBox);
     void getBatchInfo(int &batchStepX, int &batchStepY);
-
-    void init_halfViaEncArea();
-    void init_via2viaMinLen();
-    frCoord init_via2viaMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2);
-    frCoord init_via2viaMinLen_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2);
-    bool init_via2viaMinLen_minimumcut2(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2);
-    
-    void init_via2viaMinLenNew();
-    frCoord init_via2viaMinLenNew_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY);
-    frCoord init_via2viaMinLenNew_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY);
-    frCoord init_via2viaMinLenNew_cutSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY);
-
-    frCoord init_via2turnMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY);
-    frCoord init_via2turnMinLen_minStp(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY);
-    void init_via2turnMinLen();
+    void reportWorkerStats(int iter, std::vector<drWorkerStat> &stats, const std::vector<double> &batchTimes);
+    void searchRepair_numaBatch(std::vector<std::unique_ptr<FlexDRWorker> > &workersInBatch,
+                                std::vector<drNumaStat> &numaStats, const std::function<void(FlexDRWorker*)> &workerDone);
+    void reportNumaStats(int iter, const std::vector<drNumaStat> &numaStats);
+    // distributed DR
+    uint64_t dist_getKey();
+    void dist_init();
+    void dist_runBatch(std::vector<std::unique_ptr<FlexDRWorker> > &workersInBatch);
+    void dist_endIter(int iter);
+    void dist_end();
+    void dist_serve();
 
     void removeGCell2BoundaryPin();
     void checkConnectivity(int iter = -1);
@@ -265,10 +311,11 @@ namespace fr {
                  followGuide(false), needRecheck(false), skipRouting(false), ripupMode(1), fixMode(0), workerDRCCost(DRCCOST),
                  workerMarkerCost(MARKERCOST), workerMarkerBloatWidth(0), 
                  workerMarkerBloatDepth(0), boundaryPin(), 
-                 pinCnt(0), initNumMarkers(0),
+                 pinCnt(0), initNumMarkers(0), numRoutedNets(0), workerStat(),
                  apSVia(), fixedObjs(), planarHistoryMarkers(), viaHistoryMarkers(), 
-                 historyMarkers(std::vector<std::set<FlexMazeIdx> >(3)),
-                 nets(), owner2nets(), owner2pins(), gridGraph(drIn->getDesign(), this), markers(), rq(this), gcWorker(nullptr) /*, drcWorker(drIn->getDesign())*/ {}
+                 historyMarkerFlags(),
+                 nets(), owner2nets(), owner2pins(), gridGraph(drIn->getDesign(), this), 
+                 numRemoteExpanded(0), markers(), rq(this), gcWorker(nullptr) /*, drcWorker(drIn->getDesign())*/ {}
     // setters
     void setRouteBox(const frBox &boxIn) {
       routeBox.set(boxIn);
@@ -467,6 +514,15 @@ namespace fr {
     int getBestNumMarkers() const {
       return bestMarkers.size();
     }
+    int getNumRoutedNets() const {
+      return numRoutedNets;
+    }
+    unsigned long long getNumNodesExpanded() const {
+      return gridGraph.getNumExpanded() + numRemoteExpanded;
+    }
+    const drWorkerStat& getStat() const {
+      return workerStat;
+    }
     FlexGCWorker* getGCWorker() {
       return gcWorker;
     }
@@ -476,6 +532,11 @@ namespace fr {
     int main_mt();
     // others
     int getNumQuickMarkers();
+    // distributed DR: the settings made by searchRepair, and the results end() needs
+    void dist_writeClip(ckptBuffer &buf, const ckptIndex &index) const;
+    void dist_readClip(ckptBuffer &buf, const ckptIndex &index);
+    void dist_writeResult(ckptBuffer &buf, const ckptIndex &index) const;
+    void dist_readResult(ckptBuffer &buf, const ckptIndex &index);
     
   protected:
     typedef struct {
@@ -506,17 +567,22 @@ namespace fr {
     std::map<frNet*, std::set<std::pair<frPoint, frLayerNum> >, frBlockObjectComp> boundaryPin;
     int       pinCnt;
     int       initNumMarkers;
+    int       numRoutedNets;
+    drWorkerStat workerStat;
     std::map<FlexMazeIdx, drAccessPattern*> apSVia;
     std::vector<frBlockObject*>             fixedObjs;
-    std::set<FlexMazeIdx>                   planarHistoryMarkers;
-    std::set<FlexMazeIdx>                   viaHistoryMarkers;
-    std::vector<std::set<FlexMazeIdx> >     historyMarkers;
+    // flat gridGraph idx of nodes with marker cost, see addPlanarHistoryMarker
+    std::vector<frMIdx>                     planarHistoryMarkers;
+    std::vector<frMIdx>                     viaHistoryMarkers;
+    std::vector<char>                       historyMarkerFlags; // 1: planar, 2: via
 
     // local storage
+    frArena                                 arena; // dr objects created in main_mt, outlives nets
     std::vector<std::unique_ptr<drNet> >    nets;
     std::map<frNet*, std::vector<drNet*> >  owner2nets;
     std::map<frNet*, std::vector<std::pair<frBlockObject*, std::pair<frMIdx, frBox> > > > owner2pins;
     FlexGridGraph                           gridGraph;
+    unsigned long long                      numRemoteExpanded; // expanded by a distributed DR worker
     std::vector<frMarker>                   markers;
     std::vector<frMarker>                   bestMarkers;
     FlexDRWorkerRegionQuery                 rq;
@@ -623,6 +689,23 @@ namespace fr {
     bool initMazeCost_marker_fixMode_3_addHistoryCost(const frMarker &marker);
     bool initMazeCost_marker_fixMode_3_addHistoryCost1(const frMarker &marker);
     void initMazeCost_marker_fixMode_3_ripupNets(const frMarker &marker);
+    void addPlanarHistoryMarker(const FlexMazeIdx &mi) {
+      auto idx = gridGraph.getFlatIdx(mi.x(), mi.y(), mi.z());
+      if (!(historyMarkerFlags[idx] & 1)) {
+        historyMarkerFlags[idx] |= 1;
+        planarHistoryMarkers.push_back(idx);
+      }
+    }
+    void addViaHistoryMarker(const FlexMazeIdx &mi) {
+      auto idx = gridGraph.getFlatIdx(mi.x(), mi.y(), mi.z());
+      if (!(historyMarkerFlags[idx] & 2)) {
+        historyMarkerFlags[idx] |= 2;
+        viaHistoryMarkers.push_back(idx);
+      }
+    }
+    bool hasViaHistoryMarker(const FlexMazeIdx &mi) const {
+      return historyMarkerFlags[gridGraph.getFlatIdx(mi.x(), mi.y(), mi.z())] & 2;
+    }
     void initMazeCost_marker_route_queue(const frMarker &marker);
     void initMazeCost_marker_route_queue_addHistoryCost(const frMarker &marker);
 
@@ -0,0 +1,216 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include "dr/FlexDRRecords.h"
+
+using namespace std;
+using namespace fr;
+
+ckptIndex::ckptIndex(frDesign* designIn): design(designIn) {
+  auto tech  = design->getTech();
+  auto block = design->getTopBlock();
+  for (auto &uCon: tech->getUConstraints()) {
+    constraints.push_back(uCon.get());
+  }
+  for (auto &con: tech->getConstraints()) {
+    constraints.push_back(con.get());
+  }
+  for (int i = 0; i < (int)constraints.size(); i++) {
+    con2Idx[constraints[i]] = i;
+  }
+  for (int i = 0; i < (int)tech->getVias().size(); i++) {
+    viaDef2Idx[tech->getVias()[i].get()] = i;
+  }
+  for (int i = 0; i < (int)block->getNets().size(); i++) {
+    obj2Idx[block->getNets()[i].get()] = make_tuple(ckptNetObj, i, 0);
+  }
+  for (int i = 0; i < (int)block->getSNets().size(); i++) {
+    obj2Idx[block->getSNets()[i].get()] = make_tuple(ckptSNetObj, i, 0);
+  }
+  obj2Idx[block->getFakeVSSNet()] = make_tuple(ckptFakeSNetObj, 0, 0);
+  obj2Idx[block->getFakeVDDNet()] = make_tuple(ckptFakeSNetObj, 1, 0);
+  for (int i = 0; i < (int)block->getTerms().size(); i++) {
+    obj2Idx[block->getTerms()[i].get()] = make_tuple(ckptTermObj, i, 0);
+  }
+  for (int i = 0; i < (int)block->getBlockages().size(); i++) {
+    obj2Idx[block->getBlockages()[i].get()] = make_tuple(ckptBlockageObj, i, 0);
+  }
+  for (int i = 0; i < (int)block->getInsts().size(); i++) {
+    inst2Idx[block->getInsts()[i].get()] = i;
+  }
+}
+
+int ckptIndex::getNetIdx(frNet* net) const {
+  auto it = obj2Idx.find(net);
+  if (it == obj2Idx.end() || std::get<0>(it->second) != ckptNetObj) {
+    return -1;
+  }
+  return std::get<1>(it->second);
+}
+
+frNet* ckptIndex::getNet(int idx) const {
+  auto &nets = design->getTopBlock()->getNets();
+  if (idx < 0 || idx >= (int)nets.size()) {
+    cout <<"Error: net index " <<idx <<" out of range" <<endl;
+    exit(1);
+  }
+  return nets[idx].get();
+}
+
+frViaDef* ckptIndex::getViaDef(int idx) const {
+  auto &vias = design->getTech()->getVias();
+  if (idx < 0 || idx >= (int)vias.size()) {
+    cout <<"Error: via def index " <<idx <<" out of range" <<endl;
+    exit(1);
+  }
+  return vias[idx].get();
+}
+
+void ckptIndex::getObj(frBlockObject* obj, ckptMarkerObj &rec) const {
+  rec.type = ckptNoObj;
+  rec.idx1 = 0;
+  rec.idx2 = 0;
+  if (obj == nullptr) {
+    return;
+  }
+  if (obj->typeId() == frcInstTerm || obj->typeId() == frcInstBlockage) {
+    auto inst = (obj->typeId() == frcInstTerm) ? static_cast<frInstTerm*>(obj)->getInst()
+                                               : static_cast<frInstBlockage*>(obj)->getInst();
+    rec.idx1 = inst2Idx.at(inst);
+    if (obj->typeId() == frcInstTerm) {
+      rec.type = ckptInstTermObj;
+      auto &instTerms = inst->getInstTerms();
+      while (instTerms[rec.idx2].get() != obj) {
+        rec.idx2++;
+      }
+    } else {
+      rec.type = ckptInstBlockageObj;
+      auto &instBlks = inst->getInstBlockages();
+      while (instBlks[rec.idx2].get() != obj) {
+        rec.idx2++;
+      }
+    }
+    return;
+  }
+  auto it = obj2Idx.find(obj);
+  if (it == obj2Idx.end()) {
+    cout <<"Error: checkpoint unsupported marker object" <<endl;
+    return;
+  }
+  rec.type = std::get<0>(it->second);
+  rec.idx1 = std::get<1>(it->second);
+}
+
+frBlockObject* ckptIndex::getObj(const ckptMarkerObj &rec) const {
+  auto block = design->getTopBlock();
+  switch (rec.type) {
+    case ckptNetObj:
+      return block->getNets().at(rec.idx1).get();
+    case ckptSNetObj:
+      return block->getSNets().at(rec.idx1).get();
+    case ckptFakeSNetObj:
+      return rec.idx1 ? block->getFakeVDDNet() : block->getFakeVSSNet();
+    case ckptTermObj:
+      return block->getTerms().at(rec.idx1).get();
+    case ckptInstTermObj:
+      return block->getInsts().at(rec.idx1)->getInstTerms().at(rec.idx2).get();
+    case ckptBlockageObj:
+      return block->getBlockages().at(rec.idx1).get();
+    case ckptInstBlockageObj:
+      return block->getInsts().at(rec.idx1)->getInstBlockages().at(rec.idx2).get();
+    default:
+      return nullptr;
+  }
+}
+
+void ckptIndex::getMarker(const frMarker &marker, ckptMarker &rec, vector<ckptMarkerObj> &objs) const {
+  auto addObj = [&](int kind, frBlockObject* obj, const tuple<frLayerNum, frBox, bool> &info) {
+    ckptMarkerObj objRec;
+    memset(&objRec, 0, sizeof(objRec));
+    objRec.kind = kind;
+    getObj(obj, objRec);
+    objRec.layerNum = get<0>(info);
+    objRec.xl       = get<1>(info).left();
+    objRec.yl       = get<1>(info).bottom();
+    objRec.xh       = get<1>(info).right();
+    objRec.yh       = get<1>(info).top();
+    objRec.isFixed  = get<2>(info);
+    objs.push_back(objRec);
+  };
+  frBox box;
+  marker.getBBox(box);
+  auto it = con2Idx.find(marker.getConstraint());
+  rec = {(it == con2Idx.end()) ? -1 : it->second, marker.getLayerNum(),
+         box.left(), box.bottom(), box.right(), box.top(),
+         marker.hasDir(), marker.isH(), {(uint32_t)objs.size(), 0}};
+  for (auto src: marker.getSrcs()) {
+    addObj(0, src, make_tuple(0, frBox(), false));
+  }
+  for (auto &victim: marker.getVictims()) {
+    addObj(1, victim.first, victim.second);
+  }
+  for (auto &aggressor: marker.getAggressors()) {
+    addObj(2, aggressor.first, aggressor.second);
+  }
+  rec.objs.count = objs.size() - rec.objs.begin;
+}
+
+void ckptIndex::setMarker(const ckptMarker &rec, const ckptMarkerObj* objs, frMarker &marker) const {
+  marker.setBBox(frBox(rec.xl, rec.yl, rec.xh, rec.yh));
+  marker.setLayerNum(rec.layerNum);
+  // a constraint the tech does not own is only known to need a recheck
+  if (rec.constraintIdx >= 0 && rec.constraintIdx < (int)constraints.size()) {
+    marker.setConstraint(constraints[rec.constraintIdx]);
+  } else {
+    marker.setConstraint(design->getTech()->getLayer(rec.layerNum)->getRecheckConstraint());
+  }
+  marker.setHasDir(rec.hasDir);
+  marker.setIsH(rec.isH);
+  for (uint32_t j = 0; j < rec.objs.count; j++) {
+    auto &objRec = objs[j];
+    auto obj = getObj(objRec);
+    auto info = make_tuple(objRec.layerNum, frBox(objRec.xl, objRec.yl, objRec.xh, objRec.yh), (bool)objRec.isFixed);
+    if (objRec.kind == 0) {
+      marker.addSrc(obj);
+    } else if (objRec.kind == 1) {
+      marker.addVictim(obj, info);
+    } else {
+      marker.addAggressor(obj, info);
+    }
+  }
+}
+
+void ckptBuffer::readBytes(void* out, size_t size) {
+  if (size > data.size() - pos) {
+    cout <<"Error: truncated record buffer" <<endl;
+    exit(1);
+  }
+  memcpy(out, data.data() + pos, size);
+  pos += size;
+}
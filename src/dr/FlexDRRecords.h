@@ -0,0 +1,244 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FLEX_DR_RECORDS_H_
+#define _FLEX_DR_RECORDS_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "frDesign.h"
+
+// Fixed-size records of routes and markers. Design objects are referred to
+// by their index in the block or tech, so a record is valid in any process
+// that built the same design. Used by the DR checkpoint and by distributed DR.
+namespace fr {
+  struct ckptRange {
+    uint32_t begin;
+    uint32_t count;
+  };
+
+  struct ckptPathSeg {
+    int32_t  layerNum;
+    int32_t  bx;
+    int32_t  by;
+    int32_t  ex;
+    int32_t  ey;
+    uint32_t width;
+    int32_t  beginStyle;
+    uint32_t beginExt;
+    int32_t  endStyle;
+    uint32_t endExt;
+  };
+
+  struct ckptVia {
+    int32_t viaDefIdx;
+    int32_t x;
+    int32_t y;
+  };
+
+  struct ckptPatchWire {
+    int32_t layerNum;
+    int32_t x;
+    int32_t y;
+    int32_t xl;
+    int32_t yl;
+    int32_t xh;
+    int32_t yh;
+  };
+
+  // objects a marker can refer to, idx2 is the instTerm / instBlockage index
+  // within its inst
+  enum ckptObjEnum {
+    ckptNoObj = 0,
+    ckptNetObj,
+    ckptSNetObj,
+    ckptFakeSNetObj,
+    ckptTermObj,
+    ckptInstTermObj,
+    ckptBlockageObj,
+    ckptInstBlockageObj
+  };
+
+  // kind 0 is a src, 1 a victim and 2 an aggressor
+  struct ckptMarkerObj {
+    int32_t kind;
+    int32_t type;
+    int32_t idx1;
+    int32_t idx2;
+    int32_t layerNum;
+    int32_t xl;
+    int32_t yl;
+    int32_t xh;
+    int32_t yh;
+    int32_t isFixed;
+  };
+
+  // constraintIdx counts uConstraints first, then constraints; -1 if the
+  // constraint is not owned by the tech
+  struct ckptMarker {
+    int32_t   constraintIdx;
+    int32_t   layerNum;
+    int32_t   xl;
+    int32_t   yl;
+    int32_t   xh;
+    int32_t   yh;
+    int32_t   hasDir;
+    int32_t   isH;
+    ckptRange objs;
+  };
+
+  // works for frPathSeg and drPathSeg
+  template <class T>
+  ckptPathSeg ckptGetPathSeg(const T &pathSeg) {
+    frPoint bp, ep;
+    frSegStyle style;
+    pathSeg.getPoints(bp, ep);
+    pathSeg.getStyle(style);
+    return {pathSeg.getLayerNum(), bp.x(), bp.y(), ep.x(), ep.y(), style.getWidth(),
+            (int32_t)frEndStyleEnum(style.getBeginStyle()), style.getBeginExt(),
+            (int32_t)frEndStyleEnum(style.getEndStyle()), style.getEndExt()};
+  }
+
+  template <class T>
+  void ckptSetPathSeg(const ckptPathSeg &rec, T &pathSeg) {
+    pathSeg.setPoints(frPoint(rec.bx, rec.by), frPoint(rec.ex, rec.ey));
+    pathSeg.setLayerNum(rec.layerNum);
+    frSegStyle style;
+    style.setWidth(rec.width);
+    style.setBeginStyle(frEndStyle((frEndStyleEnum)rec.beginStyle), rec.beginExt);
+    style.setEndStyle(frEndStyle((frEndStyleEnum)rec.endStyle), rec.endExt);
+    pathSeg.setStyle(style);
+  }
+
+  // works for frPatchWire and drPatchWire
+  template <class T>
+  ckptPatchWire ckptGetPatchWire(const T &pwire) {
+    frPoint origin;
+    frBox offsetBox;
+    pwire.getOrigin(origin);
+    pwire.getOffsetBox(offsetBox);
+    return {pwire.getLayerNum(), origin.x(), origin.y(), offsetBox.left(),
+            offsetBox.bottom(), offsetBox.right(), offsetBox.top()};
+  }
+
+  template <class T>
+  void ckptSetPatchWire(const ckptPatchWire &rec, T &pwire) {
+    pwire.setLayerNum(rec.layerNum);
+    pwire.setOrigin(frPoint(rec.x, rec.y));
+    pwire.setOffsetBox(frBox(rec.xl, rec.yl, rec.xh, rec.yh));
+  }
+
+  // maps nets, via defs, constraints and marker objects to indices and back
+  class ckptIndex {
+  public:
+    ckptIndex(frDesign* designIn);
+    // getters
+    int getNetIdx(frNet* net) const;
+    frNet* getNet(int idx) const;
+    int getViaDefIdx(frViaDef* viaDef) const {
+      return viaDef2Idx.at(viaDef);
+    }
+    frViaDef* getViaDef(int idx) const;
+    // others
+    void getMarker(const frMarker &marker, ckptMarker &rec, std::vector<ckptMarkerObj> &objs) const;
+    // objs points to the rec.objs.count records of the marker
+    void setMarker(const ckptMarker &rec, const ckptMarkerObj* objs, frMarker &marker) const;
+  protected:
+    frDesign*                                                            design;
+    std::vector<frConstraint*>                                           constraints;
+    std::unordered_map<frConstraint*, int>                               con2Idx;
+    std::unordered_map<frViaDef*, int>                                   viaDef2Idx;
+    std::unordered_map<frBlockObject*, std::tuple<int, int, int> >       obj2Idx;
+    std::unordered_map<frInst*, int>                                     inst2Idx;
+
+    void getObj(frBlockObject* obj, ckptMarkerObj &rec) const;
+    frBlockObject* getObj(const ckptMarkerObj &rec) const;
+  };
+
+  // byte buffer of records for sockets; reading past the end is an error
+  class ckptBuffer {
+  public:
+    ckptBuffer(): data(), pos(0) {}
+    // getters
+    std::string& getData() {
+      return data;
+    }
+    const std::string& getData() const {
+      return data;
+    }
+    bool isEnd() const {
+      return pos == data.size();
+    }
+    // others
+    template <class T>
+    void write(const T &in) {
+      data.append(reinterpret_cast<const char*>(&in), sizeof(T));
+    }
+    template <class T>
+    void write(const std::vector<T> &in) {
+      write((uint32_t)in.size());
+      data.append(reinterpret_cast<const char*>(in.data()), in.size() * sizeof(T));
+    }
+    template <class T>
+    T read() {
+      T out;
+      readBytes(&out, sizeof(T));
+      return out;
+    }
+    template <class T>
+    void read(std::vector<T> &out) {
+      out.resize(read<uint32_t>());
+      readBytes(out.data(), out.size() * sizeof(T));
+    }
+    // a nested buffer, prefixed by its size
+    void write(const ckptBuffer &in) {
+      write((uint64_t)in.data.size());
+      data.append(in.data);
+    }
+    void read(ckptBuffer &out) {
+      out.clear();
+      out.data.resize(read<uint64_t>());
+      readBytes(&out.data[0], out.data.size());
+    }
+    void clear() {
+      data.clear();
+      pos = 0;
+    }
+  protected:
+    std::string data;
+    size_t      pos;
+
+    void readBytes(void* out, size_t size);
+  };
+}
+
+#endif
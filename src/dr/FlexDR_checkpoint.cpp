@@ -0,0 +1,303 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <unordered_map>
+#include "frProfileTask.h"
+#include "global.h"
+#include "dr/FlexDR.h"
+#include "dr/FlexDRRecords.h"
+#include "db/infra/frHash.h"
+
+using namespace std;
+using namespace fr;
+
+// A checkpoint holds what searchRepair carries from one iteration to the
+// next: the routed path segments, vias and patch wires of every net, the
+// markers left by the last iteration, the violation history and the cost
+// scale of the stall policy. Access
+// points, guides and the region query are rebuilt from the inputs on restart.
+namespace {
+  // bump whenever a record layout or the meaning of a field changes
+  const uint32_t checkpointVersion = 2;
+  const char checkpointMagic[4] = {'F', 'R', 'C', 'K'};
+
+  enum ckptSectionEnum {
+    VIOLS = 0,
+    NETS,
+    PATHSEGS,
+    VIAS,
+    PATCHWIRES,
+    MARKERS,
+    MARKEROBJS,
+    NUM_SECTIONS
+  };
+
+  struct ckptHeader {
+    char     magic[4];
+    uint32_t version;
+    uint64_t key;
+    int32_t  iter;
+    int32_t  numNets;
+    uint32_t costScale;
+    uint64_t counts[NUM_SECTIONS];
+  };
+
+  struct ckptNet {
+    ckptRange pathSegs;
+    ckptRange vias;
+    ckptRange patchWires;
+  };
+
+  const size_t ckptRecordSize[NUM_SECTIONS] = {
+    sizeof(int32_t),   sizeof(ckptNet),    sizeof(ckptPathSeg), sizeof(ckptVia),
+    sizeof(ckptPatchWire), sizeof(ckptMarker), sizeof(ckptMarkerObj)
+  };
+}
+
+// design identity: a checkpoint only applies to the same tech and net list
+uint64_t FlexDR::checkpoint_getKey() {
+  uint64_t hash = frHashSeed;
+  frHashBytes(hash, &checkpointVersion, sizeof(checkpointVersion));
+  int64_t sizes[5] = {(int64_t)getTech()->getLayers().size(), (int64_t)getTech()->getVias().size(),
+                      (int64_t)getDesign()->getTopBlock()->getInsts().size(),
+                      (int64_t)getDesign()->getTopBlock()->getNets().size(),
+                      (int64_t)(getTech()->getUConstraints().size() + getTech()->getConstraints().size())};
+  frHashBytes(hash, sizes, sizeof(sizes));
+  for (auto &net: getDesign()->getTopBlock()->getNets()) {
+    frHashString(hash, net->getName());
+  }
+  return hash;
+}
+
+void FlexDR::writeCheckpoint(int iter) {
+  ProfileTask profile("DR:writeCheckpoint");
+  auto topBlock = getDesign()->getTopBlock();
+
+  vector<int32_t>       viols(numViols.begin(), numViols.end());
+  vector<ckptNet>       nets;
+  vector<ckptPathSeg>   pathSegs;
+  vector<ckptVia>       ckptVias;
+  vector<ckptPatchWire> patchWires;
+  vector<ckptMarker>    markers;
+  vector<ckptMarkerObj> markerObjs;
+
+  ckptIndex index(getDesign());
+  for (auto &net: topBlock->getNets()) {
+    ckptNet rec;
+    rec.pathSegs.begin = pathSegs.size();
+    for (auto &uShape: net->getShapes()) {
+      if (uShape->typeId() != frcPathSeg) {
+        cout <<"Error: checkpoint unsupported shape" <<endl;
+        continue;
+      }
+      pathSegs.push_back(ckptGetPathSeg(*static_cast<frPathSeg*>(uShape.get())));
+    }
+    rec.pathSegs.count = pathSegs.size() - rec.pathSegs.begin;
+    rec.vias.begin = ckptVias.size();
+    for (auto &uVia: net->getVias()) {
+      frPoint origin;
+      uVia->getOrigin(origin);
+      ckptVias.push_back({index.getViaDefIdx(uVia->getViaDef()), origin.x(), origin.y()});
+    }
+    rec.vias.count = ckptVias.size() - rec.vias.begin;
+    rec.patchWires.begin = patchWires.size();
+    for (auto &uShape: net->getPatchWires()) {
+      patchWires.push_back(ckptGetPatchWire(*static_cast<frPatchWire*>(uShape.get())));
+    }
+    rec.patchWires.count = patchWires.size() - rec.patchWires.begin;
+    nets.push_back(rec);
+  }
+  for (auto &marker: topBlock->getMarkers()) {
+    ckptMarker rec;
+    index.getMarker(*marker, rec, markerObjs);
+    markers.push_back(rec);
+  }
+
+  ckptHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, checkpointMagic, 4);
+  header.version  = checkpointVersion;
+  header.key      = checkpoint_getKey();
+  header.iter     = iter;
+  header.numNets  = topBlock->getNets().size();
+  header.costScale = costScale;
+  const char* data[NUM_SECTIONS] = {
+    reinterpret_cast<const char*>(viols.data()),    reinterpret_cast<const char*>(nets.data()),
+    reinterpret_cast<const char*>(pathSegs.data()), reinterpret_cast<const char*>(ckptVias.data()),
+    reinterpret_cast<const char*>(patchWires.data()), reinterpret_cast<const char*>(markers.data()),
+    reinterpret_cast<const char*>(markerObjs.data())
+  };
+  size_t counts[NUM_SECTIONS] = {viols.size(), nets.size(), pathSegs.size(), ckptVias.size(),
+                                 patchWires.size(), markers.size(), markerObjs.size()};
+  for (int i = 0; i < NUM_SECTIONS; i++) {
+    header.counts[i] = counts[i];
+  }
+
+  // write aside and rename so a preempted run never leaves a partial file
+  string tmpFileName = DR_CHECKPOINT_FILE + ".tmp";
+  ofstream fout(tmpFileName.c_str(), ios::binary);
+  if (!fout.is_open()) {
+    cout <<"Warning: cannot write checkpoint " <<tmpFileName <<endl;
+    return;
+  }
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  size_t numBytes = sizeof(header);
+  for (int i = 0; i < NUM_SECTIONS; i++) {
+    fout.write(data[i], counts[i] * ckptRecordSize[i]);
+    numBytes += counts[i] * ckptRecordSize[i];
+  }
+  fout.close();
+  if (!fout || rename(tmpFileName.c_str(), DR_CHECKPOINT_FILE.c_str()) != 0) {
+    cout <<"Warning: cannot write checkpoint " <<DR_CHECKPOINT_FILE <<endl;
+    remove(tmpFileName.c_str());
+    return;
+  }
+  if (VERBOSE > 0) {
+    cout <<"  wrote checkpoint " <<DR_CHECKPOINT_FILE <<" after iteration " <<iter
+         <<" (" <<numBytes <<" bytes)" <<endl;
+  }
+}
+
+// replaces the routes and markers of the design by the ones in the
+// checkpoint, returns the iteration it was taken after
+int FlexDR::readCheckpoint(const string &fileName) {
+  ProfileTask profile("DR:readCheckpoint");
+  ifstream fin(fileName.c_str(), ios::binary);
+  if (!fin.is_open()) {
+    cout <<"Error: cannot open checkpoint " <<fileName <<endl;
+    exit(1);
+  }
+  string buffer((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
+  fin.close();
+
+  ckptHeader header;
+  bool isValid = buffer.size() >= sizeof(header);
+  if (isValid) {
+    memcpy(&header, buffer.data(), sizeof(header));
+    isValid = equal(header.magic, header.magic + 4, checkpointMagic) &&
+              header.version == checkpointVersion && header.costScale > 0;
+  }
+  size_t offsets[NUM_SECTIONS];
+  size_t offset = sizeof(header);
+  for (int i = 0; isValid && i < NUM_SECTIONS; i++) {
+    offsets[i] = offset;
+    isValid = header.counts[i] <= (buffer.size() - offset) / ckptRecordSize[i];
+    offset += header.counts[i] * ckptRecordSize[i];
+  }
+  if (!isValid || offset != buffer.size()) {
+    cout <<"Error: " <<fileName <<" is not a valid checkpoint" <<endl;
+    exit(1);
+  }
+  auto topBlock = getDesign()->getTopBlock();
+  if (header.key != checkpoint_getKey() || header.numNets != (int)topBlock->getNets().size() ||
+      header.counts[NETS] != topBlock->getNets().size()) {
+    cout <<"Error: checkpoint " <<fileName <<" does not match the design" <<endl;
+    exit(1);
+  }
+  auto getSection = [&](ckptSectionEnum idx, auto &records) {
+    records.resize(header.counts[idx]);
+    memcpy(records.data(), buffer.data() + offsets[idx], header.counts[idx] * ckptRecordSize[idx]);
+  };
+  vector<int32_t>       viols;
+  vector<ckptNet>       nets;
+  vector<ckptPathSeg>   pathSegs;
+  vector<ckptVia>       vias;
+  vector<ckptPatchWire> patchWires;
+  vector<ckptMarker>    markers;
+  vector<ckptMarkerObj> markerObjs;
+  getSection(VIOLS,      viols);
+  getSection(NETS,       nets);
+  getSection(PATHSEGS,   pathSegs);
+  getSection(VIAS,       vias);
+  getSection(PATCHWIRES, patchWires);
+  getSection(MARKERS,    markers);
+  getSection(MARKEROBJS, markerObjs);
+  auto checkRange = [&](const ckptRange &range, size_t size) {
+    if ((size_t)range.begin + range.count > size) {
+      cout <<"Error: " <<fileName <<" is not a valid checkpoint" <<endl;
+      exit(1);
+    }
+  };
+
+  ckptIndex index(getDesign());
+  for (int i = 0; i < (int)nets.size(); i++) {
+    auto net = topBlock->getNets()[i].get();
+    auto &rec = nets[i];
+    checkRange(rec.pathSegs, pathSegs.size());
+    checkRange(rec.vias, vias.size());
+    checkRange(rec.patchWires, patchWires.size());
+    while (!net->getShapes().empty()) {
+      net->removeShape(net->getShapes().front().get());
+    }
+    while (!net->getVias().empty()) {
+      net->removeVia(net->getVias().front().get());
+    }
+    while (!net->getPatchWires().empty()) {
+      net->removePatchWire(net->getPatchWires().front().get());
+    }
+    for (uint32_t j = 0; j < rec.pathSegs.count; j++) {
+      auto tmpP = make_unique<frPathSeg>();
+      ckptSetPathSeg(pathSegs[rec.pathSegs.begin + j], *tmpP);
+      net->addShape(std::move(tmpP));
+    }
+    for (uint32_t j = 0; j < rec.vias.count; j++) {
+      auto &via = vias[rec.vias.begin + j];
+      auto tmpP = make_unique<frVia>(index.getViaDef(via.viaDefIdx));
+      tmpP->setOrigin(frPoint(via.x, via.y));
+      net->addVia(std::move(tmpP));
+    }
+    for (uint32_t j = 0; j < rec.patchWires.count; j++) {
+      auto tmpP = make_unique<frPatchWire>();
+      ckptSetPatchWire(patchWires[rec.patchWires.begin + j], *tmpP);
+      net->addPatchWire(std::move(tmpP));
+    }
+  }
+
+  for (auto &rec: markers) {
+    checkRange(rec.objs, markerObjs.size());
+    auto marker = make_unique<frMarker>();
+    index.setMarker(rec, markerObjs.data() + rec.objs.begin, *marker);
+    topBlock->addMarker(std::move(marker));
+  }
+  // bulk-loaded in the order the checkpoint was written, as the run that
+  // wrote it did right after; init() does the same for the routes
+  getRegionQuery()->initMarker(getTech()->getLayers().size());
+
+  numViols.assign(viols.begin(), viols.end());
+  costScale = header.costScale;
+  if (VERBOSE > 0) {
+    cout <<endl <<"restarting detail routing from checkpoint " <<fileName <<" after iteration "
+         <<header.iter <<" with " <<topBlock->getNumMarkers() <<" violations" <<endl;
+  }
+  return header.iter;
+}
@@ -0,0 +1,692 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <omp.h>
+#include "frProfileTask.h"
+#include "global.h"
+#include "dr/FlexDR.h"
+#include "dr/FlexDRRecords.h"
+#include "db/infra/frHash.h"
+
+using namespace std;
+using namespace fr;
+
+// Distributed detailed routing. Every process reads the same inputs and runs
+// the same flow up to DR, so all of them hold the same design. The leader
+// runs the search and repair schedule and sends the clips of each batch to
+// the worker processes, which route them and return what FlexDRWorker::end()
+// needs. The results of a batch are then broadcast and every process, the
+// leader included, commits them in worker order, which keeps the replicas
+// identical for the next batch.
+namespace {
+  const uint32_t distMagic   = 0x53445246; // "FRDS"
+  const uint32_t distVersion = 1;
+
+  enum distMsgEnum {
+    HELLO = 1, // worker: version, threads, key
+    CLIPS,     // leader: clips to route
+    RESULTS,   // worker: routed clips
+    APPLY,     // leader: all results of a batch in worker order
+    ITER_END,  // leader: iteration and its number of markers
+    DONE
+  };
+
+  struct distMsgHeader {
+    uint32_t magic;
+    uint32_t type;
+    uint64_t size;
+  };
+
+  struct distHello {
+    uint32_t version;
+    uint32_t numThreads;
+    uint64_t key;
+  };
+
+  // worker settings made by searchRepair
+  struct distClip {
+    int32_t  routeBox[4];
+    int32_t  extBox[4];
+    int32_t  drcBox[4];
+    int32_t  drIter;
+    int32_t  mazeEndIter;
+    int32_t  enableDRC;
+    int32_t  followGuide;
+    int32_t  ripupMode;
+    int32_t  fixMode;
+    uint32_t costs[4];
+    uint32_t numBoundaryPins;
+  };
+
+  struct distBoundaryPin {
+    int32_t netIdx;
+    int32_t x;
+    int32_t y;
+    int32_t layerNum;
+  };
+
+  struct distResult {
+    int32_t  skipRouting;
+    int32_t  needRecheck;
+    int32_t  initNumMarkers;
+    int32_t  numRoutedNets;
+    int32_t  numNets;
+    int32_t  dims[3];
+    uint64_t numExpanded;
+    double   times[3];
+  };
+
+  // followed by numFigs (type, record) pairs
+  struct distNet {
+    int32_t  netIdx;
+    int32_t  modified;
+    uint32_t numFigs;
+  };
+
+  void setBox(const frBox &box, int32_t* out) {
+    out[0] = box.left();
+    out[1] = box.bottom();
+    out[2] = box.right();
+    out[3] = box.top();
+  }
+
+  bool sendAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+      auto n = send(fd, data, size, MSG_NOSIGNAL);
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      if (n <= 0) {
+        return false;
+      }
+      data += n;
+      size -= n;
+    }
+    return true;
+  }
+
+  bool recvAll(int fd, char* data, size_t size) {
+    while (size > 0) {
+      auto n = recv(fd, data, size, 0);
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      if (n <= 0) {
+        return false;
+      }
+      data += n;
+      size -= n;
+    }
+    return true;
+  }
+
+  void sendMsg(int fd, distMsgEnum type, const ckptBuffer &buf) {
+    distMsgHeader header = {distMagic, (uint32_t)type, buf.getData().size()};
+    if (!sendAll(fd, reinterpret_cast<const char*>(&header), sizeof(header)) ||
+        !sendAll(fd, buf.getData().data(), buf.getData().size())) {
+      cout <<"Error: distributed DR lost a connection" <<endl;
+      exit(1);
+    }
+  }
+
+  // returns the message type
+  int recvMsg(int fd, ckptBuffer &buf) {
+    distMsgHeader header;
+    buf.clear();
+    if (recvAll(fd, reinterpret_cast<char*>(&header), sizeof(header)) && header.magic == distMagic) {
+      buf.getData().resize(header.size);
+      if (recvAll(fd, &buf.getData()[0], header.size)) {
+        return header.type;
+      }
+    }
+    cout <<"Error: distributed DR lost a connection" <<endl;
+    exit(1);
+  }
+
+  // addr is unix:<path> or <host>:<port>, returns -1 on failure
+  int openSocket(const string &addr, bool isListen) {
+    int fd = -1;
+    if (addr.compare(0, 5, "unix:") == 0) {
+      string path = addr.substr(5);
+      sockaddr_un sa;
+      memset(&sa, 0, sizeof(sa));
+      sa.sun_family = AF_UNIX;
+      if (path.empty() || path.size() >= sizeof(sa.sun_path) || (fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        return -1;
+      }
+      strcpy(sa.sun_path, path.c_str());
+      bool isOk = false;
+      if (isListen) {
+        unlink(path.c_str());
+        isOk = (bind(fd, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) == 0 && listen(fd, SOMAXCONN) == 0);
+      } else {
+        isOk = (connect(fd, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) == 0);
+      }
+      if (!isOk) {
+        close(fd);
+        return -1;
+      }
+      return fd;
+    }
+    auto pos = addr.rfind(':');
+    if (pos == string::npos) {
+      return -1;
+    }
+    string host = addr.substr(0, pos);
+    string port = addr.substr(pos + 1);
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = isListen ? AI_PASSIVE : 0;
+    addrinfo* res = nullptr;
+    if (getaddrinfo((host.empty() || host == "*") ? nullptr : host.c_str(), port.c_str(), &hints, &res) != 0) {
+      return -1;
+    }
+    for (auto ai = res; ai != nullptr && fd < 0; ai = ai->ai_next) {
+      if ((fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol)) < 0) {
+        continue;
+      }
+      int on = 1;
+      bool isOk = false;
+      if (isListen) {
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        isOk = (bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 && listen(fd, SOMAXCONN) == 0);
+      } else {
+        isOk = (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0);
+        // clips and results are sent as soon as they are ready
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+      }
+      if (!isOk) {
+        close(fd);
+        fd = -1;
+      }
+    }
+    freeaddrinfo(res);
+    return fd;
+  }
+}
+
+void FlexDRWorker::dist_writeClip(ckptBuffer &buf, const ckptIndex &index) const {
+  distClip clip;
+  memset(&clip, 0, sizeof(clip));
+  setBox(routeBox, clip.routeBox);
+  setBox(extBox, clip.extBox);
+  setBox(drcBox, clip.drcBox);
+  clip.drIter      = drIter;
+  clip.mazeEndIter = mazeEndIter;
+  clip.enableDRC   = enableDRC;
+  clip.followGuide = followGuide;
+  clip.ripupMode   = ripupMode;
+  clip.fixMode     = fixMode;
+  clip.costs[0]    = workerDRCCost;
+  clip.costs[1]    = workerMarkerCost;
+  clip.costs[2]    = workerMarkerBloatWidth;
+  clip.costs[3]    = workerMarkerBloatDepth;
+  vector<distBoundaryPin> pins;
+  for (auto &[net, pts]: boundaryPin) {
+    for (auto &[pt, lNum]: pts) {
+      pins.push_back({index.getNetIdx(net), pt.x(), pt.y(), lNum});
+    }
+  }
+  clip.numBoundaryPins = pins.size();
+  buf.write(clip);
+  for (auto &pin: pins) {
+    buf.write(pin);
+  }
+}
+
+void FlexDRWorker::dist_readClip(ckptBuffer &buf, const ckptIndex &index) {
+  auto clip = buf.read<distClip>();
+  routeBox.set(clip.routeBox[0], clip.routeBox[1], clip.routeBox[2], clip.routeBox[3]);
+  extBox.set(clip.extBox[0], clip.extBox[1], clip.extBox[2], clip.extBox[3]);
+  drcBox.set(clip.drcBox[0], clip.drcBox[1], clip.drcBox[2], clip.drcBox[3]);
+  drIter      = clip.drIter;
+  mazeEndIter = clip.mazeEndIter;
+  enableDRC   = clip.enableDRC;
+  followGuide = clip.followGuide;
+  ripupMode   = clip.ripupMode;
+  fixMode     = clip.fixMode;
+  setCost(clip.costs[0], clip.costs[1], clip.costs[2], clip.costs[3]);
+  boundaryPin.clear();
+  for (uint32_t i = 0; i < clip.numBoundaryPins; i++) {
+    auto pin = buf.read<distBoundaryPin>();
+    boundaryPin[index.getNet(pin.netIdx)].insert(make_pair(frPoint(pin.x, pin.y), pin.layerNum));
+  }
+}
+
+// the best routes of the nets end() writes back, the best markers and the
+// flags end() checks; a worker read from it only supports end()
+void FlexDRWorker::dist_writeResult(ckptBuffer &buf, const ckptIndex &index) const {
+  dist_writeClip(buf, index);
+  distResult result = {skipRouting, needRecheck, initNumMarkers, numRoutedNets, workerStat.numNets,
+                       {workerStat.xDim, workerStat.yDim, workerStat.zDim}, getNumNodesExpanded(),
+                       {workerStat.initTime, workerStat.routeTime, workerStat.postTime}};
+  buf.write(result);
+
+  vector<ckptMarker>    markerRecs;
+  vector<ckptMarkerObj> markerObjs;
+  for (auto &marker: bestMarkers) {
+    markerRecs.emplace_back();
+    index.getMarker(marker, markerRecs.back(), markerObjs);
+  }
+  buf.write(markerRecs);
+  buf.write(markerObjs);
+
+  // see endGetModNets
+  set<frNet*> modNets;
+  for (auto &net: nets) {
+    if (net->isModified()) {
+      modNets.insert(net->getFrNet());
+    }
+  }
+  buf.write<uint32_t>(nets.size());
+  for (auto &net: nets) {
+    bool isWritten = (modNets.find(net->getFrNet()) != modNets.end());
+    buf.write(distNet{index.getNetIdx(net->getFrNet()), net->isModified(),
+                      isWritten ? (uint32_t)net->getBestRouteConnFigs().size() : 0});
+    if (!isWritten) {
+      continue;
+    }
+    for (auto &connFig: net->getBestRouteConnFigs()) {
+      buf.write<int32_t>(connFig->typeId());
+      if (connFig->typeId() == drcPathSeg) {
+        buf.write(ckptGetPathSeg(*static_cast<drPathSeg*>(connFig.get())));
+      } else if (connFig->typeId() == drcVia) {
+        auto via = static_cast<drVia*>(connFig.get());
+        frPoint origin;
+        via->getOrigin(origin);
+        buf.write(ckptVia{index.getViaDefIdx(via->getViaDef()), origin.x(), origin.y()});
+      } else if (connFig->typeId() == drcPatchWire) {
+        buf.write(ckptGetPatchWire(*static_cast<drPatchWire*>(connFig.get())));
+      }
+    }
+  }
+}
+
+void FlexDRWorker::dist_readResult(ckptBuffer &buf, const ckptIndex &index) {
+  dist_readClip(buf, index);
+  auto result = buf.read<distResult>();
+  skipRouting            = result.skipRouting;
+  needRecheck            = result.needRecheck;
+  initNumMarkers         = result.initNumMarkers;
+  numRoutedNets          = result.numRoutedNets;
+  // the grid graph of a result is empty, the count comes with it
+  numRemoteExpanded      = result.numExpanded;
+  workerStat.routeBox    = routeBox;
+  workerStat.numNets     = result.numNets;
+  workerStat.xDim        = result.dims[0];
+  workerStat.yDim        = result.dims[1];
+  workerStat.zDim        = result.dims[2];
+  workerStat.numExpanded = result.numExpanded;
+  workerStat.initTime    = result.times[0];
+  workerStat.routeTime   = result.times[1];
+  workerStat.postTime    = result.times[2];
+
+  vector<ckptMarker>    markerRecs;
+  vector<ckptMarkerObj> markerObjs;
+  buf.read(markerRecs);
+  buf.read(markerObjs);
+  bestMarkers.clear();
+  for (auto &rec: markerRecs) {
+    if ((size_t)rec.objs.begin + rec.objs.count > markerObjs.size()) {
+      cout <<"Error: invalid distributed DR result" <<endl;
+      exit(1);
+    }
+    bestMarkers.emplace_back();
+    index.setMarker(rec, markerObjs.data() + rec.objs.begin, bestMarkers.back());
+  }
+
+  nets.clear();
+  auto numNets = buf.read<uint32_t>();
+  for (uint32_t i = 0; i < numNets; i++) {
+    auto netRec = buf.read<distNet>();
+    auto net = make_unique<drNet>();
+    net->setFrNet(netRec.netIdx < 0 ? nullptr : index.getNet(netRec.netIdx));
+    net->setModified(netRec.modified);
+    // routing marks the net for checkConnectivity, here it was routed elsewhere
+    if (netRec.modified && net->getFrNet()) {
+      net->getFrNet()->setModified(true);
+    }
+    for (uint32_t j = 0; j < netRec.numFigs; j++) {
+      auto type = buf.read<int32_t>();
+      if (type == drcPathSeg) {
+        auto pathSeg = make_unique<drPathSeg>();
+        ckptSetPathSeg(buf.read<ckptPathSeg>(), *pathSeg);
+        net->addRoute(std::move(pathSeg));
+      } else if (type == drcVia) {
+        auto rec = buf.read<ckptVia>();
+        auto via = make_unique<drVia>(index.getViaDef(rec.viaDefIdx));
+        via->setOrigin(frPoint(rec.x, rec.y));
+        net->addRoute(std::move(via));
+      } else if (type == drcPatchWire) {
+        auto pwire = make_unique<drPatchWire>();
+        ckptSetPatchWire(buf.read<ckptPatchWire>(), *pwire);
+        net->addRoute(std::move(pwire));
+      } else {
+        cout <<"Error: invalid distributed DR result" <<endl;
+        exit(1);
+      }
+    }
+    net->setBestRouteConnFigs();
+    nets.push_back(std::move(net));
+  }
+}
+
+// design and routes at the start of DR; the leader and its workers must agree
+uint64_t FlexDR::dist_getKey() {
+  uint64_t hash = checkpoint_getKey();
+  for (auto &net: getDesign()->getTopBlock()->getNets()) {
+    vector<frConnFig*> connFigs;
+    for (auto &uShape: net->getShapes()) {
+      connFigs.push_back(uShape.get());
+    }
+    for (auto &uVia: net->getVias()) {
+      connFigs.push_back(uVia.get());
+    }
+    for (auto &uPWire: net->getPatchWires()) {
+      connFigs.push_back(uPWire.get());
+    }
+    // TA routes
+    for (auto &guide: net->getGuides()) {
+      for (auto &uConnFig: guide->getRoutes()) {
+        connFigs.push_back(uConnFig.get());
+      }
+    }
+    for (auto connFig: connFigs) {
+      if (connFig->typeId() == frcPathSeg) {
+        auto rec = ckptGetPathSeg(*static_cast<frPathSeg*>(connFig));
+        frHashBytes(hash, &rec, sizeof(rec));
+      } else if (connFig->typeId() == frcVia) {
+        auto via = static_cast<frVia*>(connFig);
+        frPoint origin;
+        via->getOrigin(origin);
+        ckptVia rec = {distIndex->getViaDefIdx(via->getViaDef()), origin.x(), origin.y()};
+        frHashBytes(hash, &rec, sizeof(rec));
+      } else if (connFig->typeId() == frcPatchWire) {
+        auto rec = ckptGetPatchWire(*static_cast<frPatchWire*>(connFig));
+        frHashBytes(hash, &rec, sizeof(rec));
+      }
+    }
+  }
+  int64_t numMarkers = getDesign()->getTopBlock()->getNumMarkers();
+  frHashBytes(hash, &numMarkers, sizeof(numMarkers));
+  return hash;
+}
+
+// the leader waits for DR_DIST_WORKERS workers, a worker connects to its leader
+void FlexDR::dist_init() {
+  if (DR_DIST_LEADER == "" && DR_DIST_WORKERS <= 0) {
+    return;
+  }
+  // main() sets it for the command line, a library caller has to
+  if (!DETERMINISTIC) {
+    cout <<"Error: distributed DR needs DETERMINISTIC" <<endl;
+    exit(1);
+  }
+  ProfileTask profile("DR:distInit");
+  distIndex = make_unique<ckptIndex>(getDesign());
+  auto key = dist_getKey();
+  ckptBuffer buf;
+  if (DR_DIST_LEADER != "") {
+    // the leader may not have reached DR yet
+    int fd = -1;
+    for (int i = 0; i < 600 && fd < 0; i++) {
+      if ((fd = openSocket(DR_DIST_LEADER, false)) < 0) {
+        this_thread::sleep_for(chrono::seconds(1));
+      }
+    }
+    if (fd < 0) {
+      cout <<"Error: cannot connect to distributed DR leader " <<DR_DIST_LEADER <<endl;
+      exit(1);
+    }
+    distFds.push_back(fd);
+    buf.write(distHello{distVersion, (uint32_t)MAX_THREADS, key});
+    sendMsg(fd, HELLO, buf);
+    if (VERBOSE > 0) {
+      cout <<"  connected to distributed DR leader " <<DR_DIST_LEADER <<endl;
+    }
+    return;
+  }
+  int listenFd = (DR_DIST_LISTEN == "") ? -1 : openSocket(DR_DIST_LISTEN, true);
+  if (listenFd < 0) {
+    cout <<"Error: cannot listen for distributed DR workers on \"" <<DR_DIST_LISTEN <<"\"" <<endl;
+    exit(1);
+  }
+  if (VERBOSE > 0) {
+    cout <<"  waiting for " <<DR_DIST_WORKERS <<" distributed DR workers on " <<DR_DIST_LISTEN <<endl <<flush;
+  }
+  while ((int)distFds.size() < DR_DIST_WORKERS) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      cout <<"Error: cannot accept distributed DR workers" <<endl;
+      exit(1);
+    }
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    if (recvMsg(fd, buf) != HELLO) {
+      cout <<"Error: unexpected message from a distributed DR worker" <<endl;
+      exit(1);
+    }
+    auto hello = buf.read<distHello>();
+    if (hello.version != distVersion || hello.key != key) {
+      cout <<"Error: distributed DR worker does not have the design and routes of the leader" <<endl;
+      exit(1);
+    }
+    distFds.push_back(fd);
+    distThreads.push_back(max((int)hello.numThreads, 1));
+  }
+  close(listenFd);
+  if (DR_DIST_LISTEN.compare(0, 5, "unix:") == 0) {
+    unlink(DR_DIST_LISTEN.substr(5).c_str());
+  }
+  if (VERBOSE > 0) {
+    cout <<"  " <<distFds.size() <<" distributed DR workers connected" <<endl;
+  }
+}
+
+// routes a batch in the worker processes and replaces its workers by the
+// results, ready for end()
+void FlexDR::dist_runBatch(vector<unique_ptr<FlexDRWorker> > &workersInBatch) {
+  ProfileTask profile("DR:distBatch");
+  int numWorkers = workersInBatch.size();
+  int numProcs   = distFds.size();
+  vector<ckptBuffer> results(numWorkers);
+  vector<int>        numPending(numProcs, 0);
+  int next    = 0;
+  int numDone = 0;
+  ckptBuffer buf;
+  // a process gets one clip per thread at a time
+  auto sendClips = [&](int k) {
+    int count = min(distThreads[k], numWorkers - next);
+    if (count <= 0) {
+      return;
+    }
+    buf.clear();
+    buf.write<uint32_t>(count);
+    for (int i = next; i < next + count; i++) {
+      buf.write<uint32_t>(i);
+      workersInBatch[i]->dist_writeClip(buf, *distIndex);
+    }
+    sendMsg(distFds[k], CLIPS, buf);
+    numPending[k] = count;
+    next += count;
+  };
+  for (int k = 0; k < numProcs; k++) {
+    sendClips(k);
+  }
+  vector<pollfd> pfds(numProcs);
+  while (numDone < numWorkers) {
+    for (int k = 0; k < numProcs; k++) {
+      pfds[k].fd      = numPending[k] ? distFds[k] : -1;
+      pfds[k].events  = POLLIN;
+      pfds[k].revents = 0;
+    }
+    if (poll(pfds.data(), numProcs, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      cout <<"Error: distributed DR poll failed" <<endl;
+      exit(1);
+    }
+    for (int k = 0; k < numProcs; k++) {
+      if (pfds[k].revents == 0) {
+        continue;
+      }
+      if (recvMsg(distFds[k], buf) != RESULTS) {
+        cout <<"Error: unexpected message from a distributed DR worker" <<endl;
+        exit(1);
+      }
+      auto count = buf.read<uint32_t>();
+      for (uint32_t i = 0; i < count; i++) {
+        auto idx = buf.read<uint32_t>();
+        if ((int)idx >= numWorkers) {
+          cout <<"Error: invalid distributed DR result" <<endl;
+          exit(1);
+        }
+        buf.read(results[idx]);
+      }
+      numDone += count;
+      numPending[k] = 0;
+      sendClips(k);
+    }
+  }
+
+  buf.clear();
+  buf.write<uint32_t>(numWorkers);
+  for (auto &result: results) {
+    buf.write(result);
+  }
+  for (auto fd: distFds) {
+    sendMsg(fd, APPLY, buf);
+  }
+  for (int i = 0; i < numWorkers; i++) {
+    workersInBatch[i] = make_unique<FlexDRWorker>(this);
+    workersInBatch[i]->dist_readResult(results[i], *distIndex);
+  }
+}
+
+// lets the workers finish the iteration the way searchRepair does
+void FlexDR::dist_endIter(int iter) {
+  if (distFds.empty()) {
+    return;
+  }
+  ckptBuffer buf;
+  buf.write<int32_t>(iter);
+  buf.write<int32_t>(getDesign()->getTopBlock()->getNumMarkers());
+  for (auto fd: distFds) {
+    sendMsg(fd, ITER_END, buf);
+  }
+}
+
+void FlexDR::dist_end() {
+  ckptBuffer buf;
+  for (auto fd: distFds) {
+    sendMsg(fd, DONE, buf);
+    close(fd);
+  }
+  distFds.clear();
+}
+
+// worker process: routes clips and commits results until the leader is done
+void FlexDR::dist_serve() {
+  ProfileTask profile("DR:distServe");
+  int fd = distFds[0];
+  ckptBuffer buf;
+  ckptBuffer result;
+  while (true) {
+    auto type = recvMsg(fd, buf);
+    if (type == CLIPS) {
+      vector<unique_ptr<FlexDRWorker> > workers(buf.read<uint32_t>());
+      vector<uint32_t> idxs(workers.size());
+      for (int i = 0; i < (int)workers.size(); i++) {
+        idxs[i] = buf.read<uint32_t>();
+        workers[i] = make_unique<FlexDRWorker>(this);
+        workers[i]->dist_readClip(buf, *distIndex);
+      }
+      omp_set_num_threads(MAX_THREADS);
+      #pragma omp parallel for schedule(dynamic)
+      for (int i = 0; i < (int)workers.size(); i++) {
+        workers[i]->main_mt();
+      }
+      buf.clear();
+      buf.write<uint32_t>(workers.size());
+      for (int i = 0; i < (int)workers.size(); i++) {
+        buf.write(idxs[i]);
+        result.clear();
+        workers[i]->dist_writeResult(result, *distIndex);
+        buf.write(result);
+      }
+      sendMsg(fd, RESULTS, buf);
+    } else if (type == APPLY) {
+      auto count = buf.read<uint32_t>();
+      for (uint32_t i = 0; i < count; i++) {
+        buf.read(result);
+        auto worker = make_unique<FlexDRWorker>(this);
+        worker->dist_readResult(result, *distIndex);
+        worker->end();
+      }
+    } else if (type == ITER_END) {
+      auto iter       = buf.read<int32_t>();
+      auto numMarkers = buf.read<int32_t>();
+      if (!iter) {
+        removeGCell2BoundaryPin();
+      }
+      checkConnectivity(iter);
+      if (numMarkers != (int)getDesign()->getTopBlock()->getNumMarkers()) {
+        cout <<"Error: distributed DR worker has " <<getDesign()->getTopBlock()->getNumMarkers()
+             <<" violations after iteration " <<iter <<", the leader " <<numMarkers <<endl;
+        exit(1);
+      }
+      if (VERBOSE > 0) {
+        cout <<"  iteration " <<iter <<" done with " <<numMarkers <<" violations" <<endl;
+      }
+    } else if (type == DONE) {
+      break;
+    } else {
+      cout <<"Error: unexpected message from the distributed DR leader" <<endl;
+      exit(1);
+    }
+  }
+  close(fd);
+  distFds.clear();
+}
@@ -502,9 +502,11 @@ void FlexDRWorker::cleanup() {
   fixedObjs.clear();
   fixedObjs.shrink_to_fit();
   planarHistoryMarkers.clear();
+  planarHistoryMarkers.shrink_to_fit();
   viaHistoryMarkers.clear();
-  historyMarkers.clear();
-  historyMarkers.shrink_to_fit();
+  viaHistoryMarkers.shrink_to_fit();
+  historyMarkerFlags.clear();
+  historyMarkerFlags.shrink_to_fit();
   for (auto &net: getNets()) {
     net->cleanup();
   }
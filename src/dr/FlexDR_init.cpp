@@ -2001,6 +2001,9 @@ void FlexDRWorker::initGridGraph() {
   initTrackCoords(xMap, yMap);
   gridGraph.setCost(workerDRCCost, workerMarkerCost);
   gridGraph.init(getRouteBox(), getExtBox(), xMap, yMap, isInitDR(), isFollowGuide());
+  frMIdx xDim, yDim, zDim;
+  gridGraph.getDim(xDim, yDim, zDim);
+  historyMarkerFlags.assign(xDim * yDim * zDim, 0);
   //gridGraph.print();
 }
 
@@ -2428,7 +2431,7 @@ void FlexDRWorker::initMazeCost_marker_fixMode_0(const frMarker &marker) {
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<i <<", " <<psMIdx1.y() <<", " <<psMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(i, psMIdx1.y(), psMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(i, psMIdx1.y(), psMIdx1.z()));
         }
       } else {
         for (int i = max(0, max(psMIdx1.y(), mIdx1.y() - 1)); 
@@ -2437,7 +2440,7 @@ void FlexDRWorker::initMazeCost_marker_fixMode_0(const frMarker &marker) {
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<psMIdx1.x() <<", " <<i <<", " <<psMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(psMIdx1.x(), i, psMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(psMIdx1.x(), i, psMIdx1.z()));
         }
       }
 
@@ -2463,7 +2466,7 @@ void FlexDRWorker::initMazeCost_marker_fixMode_0(const frMarker &marker) {
       if (enableOutput) {
         cout <<"add marker cost via @(" <<mIdx1.x() <<", " <<mIdx1.y() <<", " <<mIdx1.z() <<")" <<endl;
       }
-      viaHistoryMarkers.insert(mIdx1);
+      addViaHistoryMarker(mIdx1);
     } else if (connFig->typeId() == drcPatchWire) {
       // TODO: could add marker // for now we think the other part in the violation would not be patchWire
       auto obj = static_cast<drPatchWire*>(connFig);
@@ -2478,7 +2481,7 @@ void FlexDRWorker::initMazeCost_marker_fixMode_0(const frMarker &marker) {
         gridGraph.getMazeIdx(mIdx1, bp, lNum);
         connFig->getNet()->setRipup();
         gridGraph.addMarkerCostPlanar(mIdx1.x(), mIdx1.y(), mIdx1.z());
-        planarHistoryMarkers.insert(FlexMazeIdx(mIdx1.x(), mIdx1.y(), mIdx1.z()));
+        addPlanarHistoryMarker(FlexMazeIdx(mIdx1.x(), mIdx1.y(), mIdx1.z()));
         if (enableOutput) {
           cout <<"ripup pwire from " <<connFig->getNet()->getFrNet()->getName() <<endl;
         }
@@ -2775,7 +2778,7 @@ void FlexDRWorker::initMazeCost_marker_route_queue_addHistoryCost(const frMarker
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<i <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(i, objMIdx1.y(),objMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(i, objMIdx1.y(),objMIdx1.z()));
         }
       } else {
         for (int i = max(objMIdx1.y(), mIdx1.y()); i <= min(objMIdx2.y(), mIdx2.y()); i++) {
@@ -2783,7 +2786,7 @@ void FlexDRWorker::initMazeCost_marker_route_queue_addHistoryCost(const frMarker
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<objMIdx1.x() <<", " <<i <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(objMIdx1.x(), i, objMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(objMIdx1.x(), i, objMIdx1.z()));
         }
       }
     } else if (connFig->typeId() == drcVia) {
@@ -2796,12 +2799,12 @@ void FlexDRWorker::initMazeCost_marker_route_queue_addHistoryCost(const frMarker
       if (vioNets.find(obj->getNet()) == vioNets.end()) {
         // add history cost
         obj->getMazeIdx(objMIdx1, objMIdx2);
-        if (viaHistoryMarkers.find(objMIdx1) == viaHistoryMarkers.end()) {
+        if (!hasViaHistoryMarker(objMIdx1)) {
           gridGraph.addMarkerCostVia(objMIdx1.x(), objMIdx1.y(), objMIdx1.z());
           if (enableOutput) {
             cout <<"add marker cost via @(" <<objMIdx1.x() <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          viaHistoryMarkers.insert(objMIdx1);
+          addViaHistoryMarker(objMIdx1);
 
           vioNets.insert(obj->getNet());
         }
@@ -2828,7 +2831,7 @@ void FlexDRWorker::initMazeCost_marker_route_queue_addHistoryCost(const frMarker
           gridGraph.addMarkerCost(xIdx, yIdx, startIdx.z(), frDirEnum::U); // always block upper via in case stack via
           gridGraph.addMarkerCost(xIdx, yIdx, startIdx.z(), frDirEnum::D); // always block upper via in case stack via
           FlexMazeIdx objMIdx(xIdx, yIdx, startIdx.z());
-          planarHistoryMarkers.insert(objMIdx);
+          addPlanarHistoryMarker(objMIdx);
         }
       }
     }
@@ -2981,7 +2984,7 @@ bool FlexDRWorker::initMazeCost_marker_fixMode_3_addHistoryCost(const frMarker &
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<i <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(i, objMIdx1.y(),objMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(i, objMIdx1.y(),objMIdx1.z()));
         }
       } else {
         for (int i = max(objMIdx1.y(), mIdx1.y()); i <= min(objMIdx2.y(), mIdx2.y()); i++) {
@@ -2989,7 +2992,7 @@ bool FlexDRWorker::initMazeCost_marker_fixMode_3_addHistoryCost(const frMarker &
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<objMIdx1.x() <<", " <<i <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(objMIdx1.x(), i, objMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(objMIdx1.x(), i, objMIdx1.z()));
         }
       }
     } else if (connFig->typeId() == drcVia) {
@@ -3006,7 +3009,7 @@ bool FlexDRWorker::initMazeCost_marker_fixMode_3_addHistoryCost(const frMarker &
       if (enableOutput) {
         cout <<"add marker cost via @(" <<objMIdx1.x() <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
       }
-      viaHistoryMarkers.insert(objMIdx1);
+      addViaHistoryMarker(objMIdx1);
     } else if (connFig->typeId() == drcPatchWire) {
       auto obj = static_cast<drPatchWire*>(connFig);
       obj->getOrigin(bp);
@@ -3023,7 +3026,7 @@ bool FlexDRWorker::initMazeCost_marker_fixMode_3_addHistoryCost(const frMarker &
       if (enableOutput) {
         cout <<"add marker cost patchwire @(" <<objMIdx1.x() <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
       }
-      planarHistoryMarkers.insert(objMIdx1);
+      addPlanarHistoryMarker(objMIdx1);
     }
   }
   return fixable;
@@ -3138,22 +3141,8 @@ void FlexDRWorker::route_queue_resetRipup() {
 }
 
 void FlexDRWorker::route_queue_markerCostDecay() {
-  for (auto it = planarHistoryMarkers.begin(); it != planarHistoryMarkers.end();) {
-    auto currIt = it;
-    auto &mi = *currIt;
-    ++it;
-    if (gridGraph.decayMarkerCostPlanar(mi.x(), mi.y(), mi.z(), MARKERDECAY)) {
-      planarHistoryMarkers.erase(currIt);
-    }
-  }
-  for (auto it = viaHistoryMarkers.begin(); it != viaHistoryMarkers.end();) {
-    auto currIt = it;
-    auto &mi = *currIt;
-    ++it;
-    if (gridGraph.decayMarkerCostVia(mi.x(), mi.y(), mi.z(), MARKERDECAY)) {
-      viaHistoryMarkers.erase(currIt);
-    }
-  }
+  gridGraph.decayMarkerCosts(planarHistoryMarkers, historyMarkerFlags, 1, false, MARKERDECAY);
+  gridGraph.decayMarkerCosts(viaHistoryMarkers,    historyMarkerFlags, 2, true,  MARKERDECAY);
 }
 
 void FlexDRWorker::route_queue_addMarkerCost(const vector<unique_ptr<frMarker> > &markers) {
@@ -3217,6 +3206,19 @@ void FlexDRWorker::route_queue_init_queue(queue<RouteQueueEntry> &rerouteQueue)
       initMazeCost_via_helper(net, true);
       // no need to clear the net because route objs are not pushed to the net (See FlexDRWorker::initNet)
     }
+  } else if (getRipupMode() == 3) {
+    // eco: the changed nets were ripped up before dr, the other nets keep their routes
+    vector<drNet*> ecoNets;
+    for (auto &net: nets) {
+      if (getDR()->isEcoNet(net->getFrNet())) {
+        ecoNets.push_back(net.get());
+      }
+    }
+    mazeIterInit_sortRerouteNets(0, ecoNets);
+    for (auto &net: ecoNets) {
+      routes.push_back({net, 0, true});
+      initMazeCost_via_helper(net, true);
+    }
   } else {
     cout << "Error: unsupported ripup mode\n";
   }
@@ -3227,6 +3229,10 @@ void FlexDRWorker::route_queue_update_queue(const vector<RouteQueueEntry> &check
                                             const vector<RouteQueueEntry> &routes,
                                             queue<RouteQueueEntry> &rerouteQueue) {
   for (auto &route: routes) {
+    // the unchanged nets have no boundary pins in an eco pass and cannot be rerouted
+    if (getRipupMode() == 3 && !getDR()->isEcoNet(static_cast<drNet*>(route.block)->getFrNet())) {
+      continue;
+    }
     rerouteQueue.push(route);
   }
   for (auto &check: checks) {
@@ -3405,22 +3411,8 @@ void FlexDRWorker::initMazeCost_marker() {
   //bool enableOutput = false;
   // decay all existing mi
   // old
-  for (auto it = planarHistoryMarkers.begin(); it != planarHistoryMarkers.end();) {
-    auto currIt = it;
-    auto &mi = *currIt;
-    ++it;
-    if (gridGraph.decayMarkerCostPlanar(mi.x(), mi.y(), mi.z(), MARKERDECAY)) {
-      planarHistoryMarkers.erase(currIt);
-    }
-  }
-  for (auto it = viaHistoryMarkers.begin(); it != viaHistoryMarkers.end();) {
-    auto currIt = it;
-    auto &mi = *currIt;
-    ++it;
-    if (gridGraph.decayMarkerCostVia(mi.x(), mi.y(), mi.z(), MARKERDECAY)) {
-      viaHistoryMarkers.erase(currIt);
-    }
-  }
+  gridGraph.decayMarkerCosts(planarHistoryMarkers, historyMarkerFlags, 1, false, MARKERDECAY);
+  gridGraph.decayMarkerCosts(viaHistoryMarkers,    historyMarkerFlags, 2, true,  MARKERDECAY);
   // new 
   //for (int i = 0; i < 3; i++) {
   //  frDirEnum dir = frDirEnum::UNKNOWN;
@@ -277,25 +277,14 @@ void FlexDRWorker::modMinSpacingCost(drNet* net, const frBox &box, frMIdx z, int
   // layer default width
   frCoord width2planar     = getDesign()->getTech()->getLayer(lNum)->getWidth();
   frCoord halfwidth2planar = width2planar / 2;
-  frViaDef* viaDefL = (lNum > getDesign()->getTech()->getBottomLayerNum()) ? 
-                      getDesign()->getTech()->getLayer(lNum-1)->getDefaultViaDef() : 
-                      nullptr;
-  frVia viaL(viaDefL);
-  frBox viaBoxL(0,0,0,0);
-  if (viaDefL) {
-    viaL.getLayer2BBox(viaBoxL);
-  }
+  auto &costInfo = getDR()->getLayerCostInfo(lNum);
+  frViaDef* viaDefL   = costInfo.viaDefL;
+  const frBox &viaBoxL = costInfo.viaBoxL;
   frCoord width2viaL  = viaBoxL.width();
   frCoord length2viaL = viaBoxL.length();
   // obj2 viaU = other obj
-  frViaDef* viaDefU = (lNum < getDesign()->getTech()->getTopLayerNum()) ? 
-                      getDesign()->getTech()->getLayer(lNum+1)->getDefaultViaDef() : 
-                      nullptr;
-  frVia viaU(viaDefU);
-  frBox viaBoxU(0,0,0,0);
-  if (viaDefU) {
-    viaU.getLayer1BBox(viaBoxU);
-  }
+  frViaDef* viaDefU   = costInfo.viaDefU;
+  const frBox &viaBoxU = costInfo.viaBoxU;
   frCoord width2viaU  = viaBoxU.width();
   frCoord length2viaU = viaBoxU.length();
 
@@ -327,30 +316,25 @@ void FlexDRWorker::modMinSpacingCost(drNet* net, const frBox &box, frMIdx z, int
   }
 
   // other obj eol spc to curr obj
-  // no need to bloat eolWithin because eolWithin always < minSpacing
-  frCoord bloatDistEolX = 0;
-  frCoord bloatDistEolY = 0;
-  for (auto con: getDesign()->getTech()->getLayer(lNum)->getEolSpacing()) {
-    auto eolSpace  = con->getMinSpacing();
-    auto eolWidth  = con->getEolWidth();
-    // eol up and down
-    if (viaDefL && viaBoxL.right() - viaBoxL.left() < eolWidth) {
-      bloatDistEolY = max(bloatDistEolY, eolSpace);
-    } 
-    if (viaDefU && viaBoxU.right() - viaBoxU.left() < eolWidth) {
-      bloatDistEolY = max(bloatDistEolY, eolSpace);
-    } 
-    // eol left and right
-    if (viaDefL && viaBoxL.top() - viaBoxL.bottom() < eolWidth) {
-      bloatDistEolX = max(bloatDistEolX, eolSpace);
-    }
-    if (viaDefU && viaBoxU.top() - viaBoxU.bottom() < eolWidth) {
-      bloatDistEolX = max(bloatDistEolX, eolSpace);
-    }
-  }
+  frCoord bloatDistEolX = max(costInfo.eolBloatXL, costInfo.eolBloatXU);
+  frCoord bloatDistEolY = max(costInfo.eolBloatYL, costInfo.eolBloatYU);
 
   frCoord bloatDist = max(max(bloatDistPlanar, bloatDistViaL), bloatDistViaU);
 
+  // planar req dist only depends on whether prl > 0
+  frCoord reqDistPlanarPrl   = 0;
+  frCoord reqDistPlanarNoPrl = 0;
+  if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
+    reqDistPlanarPrl   = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
+    reqDistPlanarNoPrl = reqDistPlanarPrl;
+  } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+    reqDistPlanarPrl   = bloatDistPlanar;
+    reqDistPlanarNoPrl = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2planar), 0);
+  } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
+    reqDistPlanarPrl   = bloatDistPlanar;
+    reqDistPlanarNoPrl = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2planar, 0);
+  }
+
   FlexMazeIdx mIdx1;
   FlexMazeIdx mIdx2;
   // assumes width always > 2
@@ -381,13 +365,7 @@ void FlexDRWorker::modMinSpacingCost(drNet* net, const frBox &box, frMIdx z, int
                 pt.x() + halfwidth2planar, pt.y() + halfwidth2planar);
       distSquare = box2boxDistSquare(box, tmpBx, dx, dy);
       prl = max(dx, dy);
-      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
-        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
-        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2planar), prl > 0 ? length1 : 0);
-      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
-        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2planar, prl > 0 ? length1 : 0);
-      }
+      reqDist = (prl > 0) ? reqDistPlanarPrl : reqDistPlanarNoPrl;
       if (distSquare < reqDist * reqDist) {
         switch(type) {
           case 0:
@@ -585,26 +563,21 @@ void FlexDRWorker::modMinimumcutCostVia(const frBox &box, frMIdx z, int type, bo
   frCoord width1  = box.width();
   frCoord length1 = box.length();
   // default via dimension
+  frLayerNum cutLayerNum = isUpperVia ? lNum + 1 : lNum - 1;
   frViaDef* viaDef = nullptr;
   if (isUpperVia) {
     viaDef = (lNum < getDesign()->getTech()->getTopLayerNum()) ? 
-             getDesign()->getTech()->getLayer(lNum+1)->getDefaultViaDef() : 
+             getDR()->getLayerCostInfo(cutLayerNum).cutViaDef : 
              nullptr;
   } else {
     viaDef = (lNum > getDesign()->getTech()->getBottomLayerNum()) ? 
-             getDesign()->getTech()->getLayer(lNum-1)->getDefaultViaDef() : 
+             getDR()->getLayerCostInfo(cutLayerNum).cutViaDef : 
              nullptr;
   }
   if (viaDef == nullptr) {
     return;
   }
-  frVia via(viaDef);
-  frBox viaBox(0,0,0,0);
-  if (isUpperVia) {
-    via.getCutBBox(viaBox);
-  } else {
-    via.getCutBBox(viaBox);
-  }
+  const frBox &viaBox = getDR()->getLayerCostInfo(cutLayerNum).cutBox;
   
   FlexMazeIdx mIdx1, mIdx2;
   frBox bx, tmpBx, sViaBox;
@@ -727,43 +700,23 @@ void FlexDRWorker::modMinSpacingCostVia(const frBox &box, frMIdx z, int type, bo
   frCoord width1  = box.width();
   frCoord length1 = box.length();
   // default via dimension
-  frViaDef* viaDef = nullptr;
-  if (isUpperVia) {
-    viaDef = (lNum < getDesign()->getTech()->getTopLayerNum()) ? 
-             getDesign()->getTech()->getLayer(lNum+1)->getDefaultViaDef() : 
-             nullptr;
-  } else {
-    viaDef = (lNum > getDesign()->getTech()->getBottomLayerNum()) ? 
-             getDesign()->getTech()->getLayer(lNum-1)->getDefaultViaDef() : 
-             nullptr;
-  }
+  auto &costInfo = getDR()->getLayerCostInfo(lNum);
+  frViaDef* viaDef = isUpperVia ? costInfo.viaDefU : costInfo.viaDefL;
   if (viaDef == nullptr) {
     return;
   }
-  frVia via(viaDef);
-  frBox viaBox(0,0,0,0);
-  if (isUpperVia) {
-    via.getLayer1BBox(viaBox);
-  } else {
-    via.getLayer2BBox(viaBox);
-  }
+  const frBox &viaBox = isUpperVia ? costInfo.viaBoxU : costInfo.viaBoxL;
   frCoord width2  = viaBox.width();
   frCoord length2 = viaBox.length();
   
   // via prl should check min area patch metal if not fat via
-  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
   bool isH = (getDesign()->getTech()->getLayer(lNum)->getDir() == frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
-  bool isFatVia = (isH) ? 
-                  (viaBox.top() - viaBox.bottom() > defaultWidth) : 
-                  (viaBox.right() - viaBox.left() > defaultWidth);
+  bool isFatVia = isUpperVia ? costInfo.isFatViaU : costInfo.isFatViaL;
 
   frCoord length2_mar = length2;
   frCoord patchLength = 0;
   if (!isFatVia) {
-    auto minAreaConstraint = getDesign()->getTech()->getLayer(lNum)->getAreaConstraint();
-    auto minArea           = minAreaConstraint ? minAreaConstraint->getMinArea() : 0;
-    patchLength            = frCoord(ceil(1.0 * minArea / defaultWidth / getDesign()->getTech()->getManufacturingGrid())) * 
-                             frCoord(getDesign()->getTech()->getManufacturingGrid());
+    patchLength = costInfo.patchLength;
     length2_mar = max(length2_mar, patchLength);
   }
 
@@ -792,21 +745,8 @@ void FlexDRWorker::modMinSpacingCostVia(const frBox &box, frMIdx z, int type, bo
     return;
   }
   // other obj eol spc to curr obj
-  // no need to bloat eolWithin because eolWithin always < minSpacing
-  frCoord bloatDistEolX = 0;
-  frCoord bloatDistEolY = 0;
-  for (auto con: getDesign()->getTech()->getLayer(lNum)->getEolSpacing()) {
-    auto eolSpace  = con->getMinSpacing();
-    auto eolWidth  = con->getEolWidth();
-    // eol up and down
-    if (viaBox.right() - viaBox.left() < eolWidth) {
-      bloatDistEolY = max(bloatDistEolY, eolSpace);
-    } 
-    // eol left and right
-    if (viaBox.top() - viaBox.bottom() < eolWidth) {
-      bloatDistEolX = max(bloatDistEolX, eolSpace);
-    }
-  }
+  frCoord bloatDistEolX = isUpperVia ? costInfo.eolBloatXU : costInfo.eolBloatXL;
+  frCoord bloatDistEolY = isUpperVia ? costInfo.eolBloatYU : costInfo.eolBloatYL;
   //frCoord bloatDistSquare = bloatDist * bloatDist;
   
   FlexMazeIdx mIdx1;
@@ -936,26 +876,12 @@ void FlexDRWorker::modMinSpacingCostVia(const frBox &box, frMIdx z, int type, bo
            testbox.right()  + halfwidth2 - 1, testbox.top()    + halfwidth2 - 1);
   } else {
     // default via dimension
-    frViaDef* viaDef = nullptr;
-    if (eolType == 1) {
-      viaDef = (lNum > getDesign()->getTech()->getBottomLayerNum()) ? 
-               getDesign()->getTech()->getLayer(lNum-1)->getDefaultViaDef() : 
-               nullptr;
-    } else if (eolType == 2) {
-      viaDef = (lNum < getDesign()->getTech()->getTopLayerNum()) ? 
-               getDesign()->getTech()->getLayer(lNum+1)->getDefaultViaDef() : 
-               nullptr;
-    }
+    auto &costInfo = getDR()->getLayerCostInfo(lNum);
+    frViaDef* viaDef = (eolType == 2) ? costInfo.viaDefU : costInfo.viaDefL;
     if (viaDef == nullptr) {
       return;
     }
-    frVia via(viaDef);
-    frBox viaBox(0,0,0,0);
-    if (eolType == 2) { // upper via
-      via.getLayer1BBox(viaBox);
-    } else {
-      via.getLayer2BBox(viaBox);
-    }
+    const frBox &viaBox = (eolType == 2) ? costInfo.viaBoxU : costInfo.viaBoxL; // upper via : lower via
     // assumes via bbox always > 2
     bx.set(testbox.left()  - (viaBox.right() - 0) + 1, testbox.bottom() - (viaBox.top() - 0) + 1,
            testbox.right() + (0 - viaBox.left())  - 1, testbox.top()    + (0 - viaBox.bottom()) - 1);
@@ -1192,19 +1118,14 @@ void FlexDRWorker::modAdjCutSpacingCost_fixedObj(const frBox &origCutBox, frVia
   // obj1 = curr obj
   // obj2 = other obj
   // default via dimension
-  frViaDef* viaDef = getDesign()->getTech()->getLayer(lNum)->getDefaultViaDef();
-  frVia via(viaDef);
-  frBox viaBox(0,0,0,0);
-  via.getCutBBox(viaBox);
+  auto &costInfo = getDR()->getLayerCostInfo(lNum);
+  if (costInfo.cutViaDef == nullptr) {
+    return;
+  }
+  const frBox &viaBox = costInfo.cutBox;
 
   // spacing value needed
-  frCoord bloatDist = 0;
-  for (auto con: getDesign()->getTech()->getLayer(lNum)->getCutSpacing()) {
-    bloatDist = max(bloatDist, con->getCutSpacing());
-    if (con->getAdjacentCuts() != -1 && isBlockage) {
-      bloatDist = max(bloatDist, con->getCutWithin());
-    }
-  }
+  frCoord bloatDist = isBlockage ? costInfo.cutBloatBlockage : costInfo.cutBloat;
   //frCoord bloatDistSquare = bloatDist * bloatDist;
   
   FlexMazeIdx mIdx1;
@@ -1230,11 +1151,10 @@ void FlexDRWorker::modAdjCutSpacingCost_fixedObj(const frBox &origCutBox, frVia
   bool hasViol = false;
   for (int i = mIdx1.x(); i <= mIdx2.x(); i++) {
     for (int j = mIdx1.y(); j <= mIdx2.y(); j++) {
-      for (auto &uFig: via.getViaDef()->getCutFigs()) {
-        auto obj = static_cast<frRect*>(uFig.get());
-        gridGraph.getPoint(pt, i, j);
-        xform.set(pt);
-        obj->getBBox(tmpBx);
+      gridGraph.getPoint(pt, i, j);
+      xform.set(pt);
+      for (auto &figBox: costInfo.cutFigBoxes) {
+        tmpBx.set(figBox);
         tmpBx.transform(xform);
         tmpBxCenter.set((tmpBx.left() + tmpBx.right()) / 2, (tmpBx.bottom() + tmpBx.top()) / 2);
         distSquare = box2boxDistSquareNew(box, tmpBx, dx, dy);
@@ -1309,11 +1229,11 @@ void FlexDRWorker::modInterLayerCutSpacingCost(const frBox &box, frMIdx z, int t
   frViaDef* viaDef = nullptr;
   if (isUpperVia) {
     viaDef = (cutLayerNum2 <= getDesign()->getTech()->getTopLayerNum()) ? 
-             getDesign()->getTech()->getLayer(cutLayerNum2)->getDefaultViaDef() : 
+             getDR()->getLayerCostInfo(cutLayerNum2).cutViaDef : 
              nullptr;
   } else {
     viaDef = (cutLayerNum2 >= getDesign()->getTech()->getBottomLayerNum()) ? 
-             getDesign()->getTech()->getLayer(cutLayerNum2)->getDefaultViaDef() : 
+             getDR()->getLayerCostInfo(cutLayerNum2).cutViaDef : 
              nullptr;
   }
   if (viaDef == nullptr) {
@@ -1329,9 +1249,8 @@ void FlexDRWorker::modInterLayerCutSpacingCost(const frBox &box, frMIdx z, int t
   // obj1 = curr obj
   // obj2 = other obj
   // default via dimension
-  frVia via(viaDef);
-  frBox viaBox(0,0,0,0);
-  via.getCutBBox(viaBox);
+  auto &costInfo = getDR()->getLayerCostInfo(cutLayerNum2);
+  const frBox &viaBox = costInfo.cutBox;
 
   // spacing value needed
   frCoord bloatDist = con->getCutSpacing();
@@ -1358,11 +1277,10 @@ void FlexDRWorker::modInterLayerCutSpacingCost(const frBox &box, frMIdx z, int t
   bool hasViol = false;
   for (int i = mIdx1.x(); i <= mIdx2.x(); i++) {
     for (int j = mIdx1.y(); j <= mIdx2.y(); j++) {
-      for (auto &uFig: via.getViaDef()->getCutFigs()) {
-        auto obj = static_cast<frRect*>(uFig.get());
-        gridGraph.getPoint(pt, i, j);
-        xform.set(pt);
-        obj->getBBox(tmpBx);
+      gridGraph.getPoint(pt, i, j);
+      xform.set(pt);
+      for (auto &figBox: costInfo.cutFigBoxes) {
+        tmpBx.set(figBox);
         tmpBx.transform(xform);
         tmpBxCenter.set((tmpBx.left() + tmpBx.right()) / 2, (tmpBx.bottom() + tmpBx.top()) / 2);
         distSquare = box2boxDistSquareNew(box, tmpBx, dx, dy);
@@ -1920,7 +1838,7 @@ bool FlexDRWorker::route_2_x2_addHistoryCost(const frMarker &marker) {
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<i <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(i, objMIdx1.y(),objMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(i, objMIdx1.y(),objMIdx1.z()));
         }
       } else {
         for (int i = max(objMIdx1.y(), mIdx1.y()); i <= min(objMIdx2.y(), mIdx2.y()); i++) {
@@ -1928,7 +1846,7 @@ bool FlexDRWorker::route_2_x2_addHistoryCost(const frMarker &marker) {
           if (enableOutput) {
             cout <<"add marker cost planar @(" <<objMIdx1.x() <<", " <<i <<", " <<objMIdx1.z() <<")" <<endl;
           }
-          planarHistoryMarkers.insert(FlexMazeIdx(objMIdx1.x(), i, objMIdx1.z()));
+          addPlanarHistoryMarker(FlexMazeIdx(objMIdx1.x(), i, objMIdx1.z()));
         }
       }
     } else if (connFig->typeId() == drcVia) {
@@ -1945,7 +1863,7 @@ bool FlexDRWorker::route_2_x2_addHistoryCost(const frMarker &marker) {
       if (enableOutput) {
         cout <<"add marker cost via @(" <<objMIdx1.x() <<", " <<objMIdx1.y() <<", " <<objMIdx1.z() <<")" <<endl;
       }
-      viaHistoryMarkers.insert(objMIdx1);
+      addViaHistoryMarker(objMIdx1);
     } else if (connFig->typeId() == drcPatchWire) {
       ;
     }
@@ -2135,7 +2053,7 @@ void FlexDRWorker::route_queue_main(queue<RouteQueueEntry> &rerouteQueue) {
       // see route_queue_init_queue RESERVE_VIA_ACCESS
       // this is unreserve via 
       // via is reserved only when drWorker starts from nothing and via is reserved
-      if (RESERVE_VIA_ACCESS && net->getNumReroutes() == 0 && getRipupMode() == 1) {
+      if (RESERVE_VIA_ACCESS && net->getNumReroutes() == 0 && (getRipupMode() == 1 || getRipupMode() == 3)) {
         initMazeCost_via_helper(net, false);
       }
       net->clear();
@@ -2143,6 +2061,7 @@ void FlexDRWorker::route_queue_main(queue<RouteQueueEntry> &rerouteQueue) {
 
       // route
       mazeNetInit(net);
+      numRoutedNets++;
       bool isRouted = routeNet(net);
       if (isRouted == false) {
         frBox routeBox = getRouteBox();
@@ -2326,6 +2245,7 @@ void FlexDRWorker::route() {
       }
       for (auto net: rerouteNets) {
         mazeNetInit(net);
+        numRoutedNets++;
         bool isRouted = routeNet(net);
         if (isRouted == false) {
           // TODO: output maze area
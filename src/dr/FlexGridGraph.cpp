@@ -324,10 +324,11 @@ void FlexGridGraph::init(const frBox &routeBBox, const frBox &extBBox,
   bool enableOutput = false;
   // bool enableOutput = true;
 
-  halfViaEncArea = getDRWorker()->getDR()->getHalfViaEncArea();
-  via2viaMinLen  = getDRWorker()->getDR()->getVia2ViaMinLen();
-  via2turnMinLen = getDRWorker()->getDR()->getVia2TurnMinLen();
-  via2viaMinLenNew = getDRWorker()->getDR()->getVia2ViaMinLenNew();
+  halfViaEncArea   = getTech()->getHalfViaEncArea().data();
+  via2viaMinLen    = getTech()->getVia2ViaMinLen().data();
+  via2viaZeroLen   = getTech()->getVia2ViaZeroLen().data();
+  via2turnMinLen   = getTech()->getVia2TurnMinLen().data();
+  via2viaMinLenNew = getTech()->getVia2ViaMinLenNew().data();
 
   // get tracks intersecting with the Maze bbox
   map<frLayerNum, frPrefRoutingDirEnum> zMap;
@@ -422,6 +423,52 @@ void FlexGridGraph::resetPrevNodeDir() {
   prevDirs.assign(prevDirs.size(), 0);
 }
 
+// idxs is compacted in place to the nodes whose marker cost is still > 0,
+// the dropped ones get flag cleared in flags; idxs must not repeat a node
+void FlexGridGraph::decayMarkerCosts(vector<frMIdx> &idxs, vector<char> &flags, char flag, bool isVia, float d) {
+  const int pos = isVia ? 40 : 32;
+  const unsigned long long costMask = ((1ull << GRIDGRAPHDRCCOSTSIZE) - 1) << pos;
+  int numIdx  = idxs.size();
+  int numKept = 0;
+  int i = 0;
+  const __m512i vMask  = _mm512_set1_epi64(costMask);
+  const __m512i vPos   = _mm512_set1_epi64(pos);
+  const __m256  vDecay = _mm256_set1_ps(d);
+  const __m256i vZeros = _mm256_setzero_si256();
+  for (; i + 8 <= numIdx; i += 8) {
+    __m256i vIdx  = _mm256_loadu_si256((const __m256i*)&idxs[i]);
+    __m512i vBits = _mm512_i32gather_epi64(vIdx, (const long long*)&bits[0], 8);
+    __m256i vCost = _mm512_cvtepi64_epi32(_mm512_srlv_epi64(_mm512_and_epi64(vBits, vMask), vPos));
+    // same float multiply and truncation as the scalar int *= float
+    vCost = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(vCost), vDecay));
+    vCost = _mm256_max_epi32(vCost, vZeros);
+    vBits = _mm512_or_epi64(_mm512_andnot_epi64(vMask, vBits), 
+                            _mm512_sllv_epi64(_mm512_cvtepu32_epi64(vCost), vPos));
+    _mm512_i32scatter_epi64((long long*)&bits[0], vIdx, vBits, 8);
+    __mmask8 isKept = _mm256_cmpneq_epi32_mask(vCost, vZeros);
+    for (int k = 0; k < 8; k++) {
+      if (!((isKept >> k) & 1)) {
+        flags[idxs[i + k]] &= ~flag;
+      }
+    }
+    _mm256_mask_compressstoreu_epi32(&idxs[numKept], isKept, vIdx);
+    numKept += __builtin_popcount(isKept);
+  }
+  for (; i < numIdx; i++) {
+    auto idx = idxs[i];
+    int currCost = getBits(idx, pos, GRIDGRAPHDRCCOSTSIZE);
+    currCost *= d;
+    currCost = std::max(0, currCost);
+    setBits(idx, pos, GRIDGRAPHDRCCOSTSIZE, currCost);
+    if (currCost == 0) {
+      flags[idx] &= ~flag;
+    } else {
+      idxs[numKept++] = idx;
+    }
+  }
+  idxs.resize(numKept);
+}
+
 // print the grid graph with edge and vertex for debug purpose
 void FlexGridGraph::print() const {
   ofstream mazeLog(OUT_MAZE_FILE.c_str());
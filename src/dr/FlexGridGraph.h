@@ -51,8 +51,8 @@ namespace fr {
                   design(designIn), drWorker(workerIn),
                   xCoords(), yCoords(), zCoords(), zHeights(),
                   ggDRCCost(0), ggMarkerCost(0), halfViaEncArea(nullptr),
-                  via2viaMinLen(nullptr), via2viaMinLenNew(nullptr),
-                  via2turnMinLen(nullptr) {}
+                  via2viaMinLen(nullptr), via2viaZeroLen(nullptr), via2viaMinLenNew(nullptr),
+                  via2turnMinLen(nullptr), numExpanded(0) {}
     // getters
     frTechObject* getTech() const {
       return design->getTech();
@@ -63,6 +63,10 @@ namespace fr {
     FlexDRWorker* getDRWorker() const {
       return drWorker;
     }
+    // number of wavefront nodes expanded by search() so far
+    unsigned long long getNumExpanded() const {
+      return numExpanded;
+    }
     // getters
     // unsafe access, no check
     bool hasAStarCost(frMIdx x, frMIdx y, frMIdx z) const {
@@ -493,6 +497,12 @@ namespace fr {
       setBits(idx, 40, GRIDGRAPHDRCCOSTSIZE, currCost);
       return (currCost == 0);
     }
+    // flat node index as used by the history marker lists
+    frMIdx getFlatIdx(frMIdx x, frMIdx y, frMIdx z) const {
+      return getIdx(x, y, z);
+    }
+    // decayMarkerCostPlanar / Via over a list of flat node indices
+    void decayMarkerCosts(std::vector<frMIdx> &idxs, std::vector<char> &flags, char flag, bool isVia, float d);
     bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z) {
       auto idx = getIdx(x, y, z);
       int currCost = (getBits(idx, 32, GRIDGRAPHDRCCOSTSIZE));
@@ -734,21 +744,22 @@ namespace fr {
       ggMarkerCost = markerCostIn;
     }
     frCoord getHalfViaEncArea(frMIdx z, bool isLayer1) const {
-      return (isLayer1 ? (*halfViaEncArea)[z].first: (*halfViaEncArea)[z].second);
+      return halfViaEncArea[((unsigned)z << 1) + (unsigned)!isLayer1];
     }
     bool allowVia2ViaZeroLen(frMIdx z, bool isPrevViaUp, bool isCurrViaUp) const {
-      return ((*via2viaMinLen)[z].second)[((unsigned)isPrevViaUp << 1) + (unsigned)isCurrViaUp];
+      return via2viaZeroLen[((unsigned)z << 2) + ((unsigned)isPrevViaUp << 1) + (unsigned)isCurrViaUp];
     }
     frCoord getVia2ViaMinLen(frMIdx z, bool isPrevViaUp, bool isCurrViaUp) const {
-      return ((*via2viaMinLen)[z].first)[((unsigned)isPrevViaUp << 1) + (unsigned)isCurrViaUp];
+      return via2viaMinLen[((unsigned)z << 2) + ((unsigned)isPrevViaUp << 1) + (unsigned)isCurrViaUp];
     }
     frCoord getVia2ViaMinLenNew(frMIdx z, bool isPrevViaUp, bool isCurrViaUp, bool isCurrDirY) const {
-      return (*via2viaMinLenNew)[z][((unsigned)isPrevViaUp << 2) + 
-                                    ((unsigned)isCurrViaUp << 1) +
-                                     (unsigned)isCurrDirY];
+      return via2viaMinLenNew[((unsigned)z << 3) +
+                              ((unsigned)isPrevViaUp << 2) + 
+                              ((unsigned)isCurrViaUp << 1) +
+                               (unsigned)isCurrDirY];
     }
     frCoord getVia2TurnMinLen(frMIdx z, bool isPrevViaUp, bool isCurrDirY) const {
-      return (*via2turnMinLen)[z][((unsigned)isPrevViaUp << 1) + (unsigned)isCurrDirY];
+      return via2turnMinLen[((unsigned)z << 2) + ((unsigned)isPrevViaUp << 1) + (unsigned)isCurrDirY];
     }
 
     void simd_set_vars(){
@@ -847,14 +858,13 @@ namespace fr {
     bits_pos_hdc, bits_tmp_hdc, bits_pos_hmc, bits_tmp_hmc, bits_pos_hsc, bits_tmp_hsc, bit_vals, bit_vals_he_hgc_ib, 
     has_edge, has_grid_cost, is_blocked, bit_vals_hdc_hmc_hsc, has_drc_cost, has_marker_cost, has_shape_cost;
 
-    const std::vector<std::pair<frCoord, frCoord> >* halfViaEncArea; // std::pair<layer1area, layer2area>
-    // via2viaMinLen[z][0], last via is down, curr via is down
-    // via2viaMinLen[z][1], last via is down, curr via is up
-    // via2viaMinLen[z][2], last via is up, curr via is down
-    // via2viaMinLen[z][3], last via is up, curr via is up
-    const std::vector<std::pair<std::vector<frCoord>, std::vector<bool> > >* via2viaMinLen;
-    const std::vector<std::vector<frCoord> >* via2viaMinLenNew;
-    const std::vector<std::vector<frCoord> >* via2turnMinLen;
+    // flat min length tables owned by tech, see frTechObject for layout
+    const frCoord* halfViaEncArea;
+    const frCoord* via2viaMinLen;
+    const char*    via2viaZeroLen;
+    const frCoord* via2viaMinLenNew;
+    const frCoord* via2turnMinLen;
+    unsigned long long numExpanded;
 
     // internal getters
     bool getBit(frMIdx idx, frMIdx pos) const {
@@ -781,6 +781,7 @@ bool FlexGridGraph::search(vector<FlexMazeIdx> &connComps, drPin* nextPin, vecto
       return true;
     } else {
       // expand and update wavefront
+      ++numExpanded;
       expandWavefront(currGrid, dstMazeIdx1, dstMazeIdx2, centerPt);
     }
     
@@ -30,6 +30,7 @@
 #define _FR_DESIGN_H_
 
 #include <memory>
+#include <unordered_map>
 #include "global.h"
 #include "frBaseTypes.h"
 #include "db/obj/frBlock.h"
@@ -76,7 +77,7 @@ namespace fr {
     friend class io::Parser;
   protected:
     std::unique_ptr<frBlock>                      topBlock;
-    std::map<frString, frBlock*>                  name2refBlock;
+    std::unordered_map<frString, frBlock*>        name2refBlock;
     std::vector<std::unique_ptr<frBlock> >        refBlocks;
     std::unique_ptr<frTechObject>                 tech;
     std::unique_ptr<frRegionQuery>                rq;
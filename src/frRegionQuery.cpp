@@ -55,6 +55,7 @@ struct frRegionQuery::Impl
     void initGuide(frLayerNum numLayers);
     void initGRPin(vector<pair<frBlockObject*, frPoint> > &in);
     void initDRObj(frLayerNum numLayers);
+    void initMarker(frLayerNum numLayers);
   
     void add(frShape* in,    ObjectsByLayer<frBlockObject> &allShapes);
     void add(frVia* in,      ObjectsByLayer<frBlockObject> &allShapes);
@@ -141,6 +142,70 @@ void frRegionQuery::removeMarker(frMarker* in) {
   impl->markers.at(in->getLayerNum()).remove(make_pair(boostb, in));
 }
 
+void frRegionQuery::addGuide(frGuide* guide) {
+  frBox frb;
+  guide->getBBox(frb);
+  box_t boostb(point_t(frb.left(), frb.bottom()), point_t(frb.right(), frb.top()));
+  for (int i = guide->getBeginLayerNum(); i <= guide->getEndLayerNum(); i++) {
+    impl->guides.at(i).insert(make_pair(boostb, guide));
+  }
+}
+
+void frRegionQuery::removeGuide(frGuide* guide) {
+  frBox frb;
+  guide->getBBox(frb);
+  box_t boostb(point_t(frb.left(), frb.bottom()), point_t(frb.right(), frb.top()));
+  for (int i = guide->getBeginLayerNum(); i <= guide->getEndLayerNum(); i++) {
+    impl->guides.at(i).remove(make_pair(boostb, guide));
+  }
+}
+
+void frRegionQuery::addOrigGuide(frNet* net, const frRect &rect) {
+  frBox frb;
+  rect.getBBox(frb);
+  box_t boostb(point_t(frb.left(), frb.bottom()), point_t(frb.right(), frb.top()));
+  impl->origGuides.at(rect.getLayerNum()).insert(make_pair(boostb, net));
+}
+
+// the raw guides are not kept anywhere else, so this scans the whole tree
+void frRegionQuery::removeOrigGuides(const set<frNet*, frBlockObjectComp> &nets) {
+  for (auto &tree: impl->origGuides) {
+    Objects<frNet> victims;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+      if (nets.find(it->second) != nets.end()) {
+        victims.push_back(*it);
+      }
+    }
+    for (auto &victim: victims) {
+      tree.remove(victim);
+    }
+  }
+}
+
+void frRegionQuery::addGRPin(frBlockObject* pin, const frPoint &pt) {
+  box_t boostb(point_t(pt.x(), pt.y()), point_t(pt.x(), pt.y()));
+  impl->grPins.insert(make_pair(boostb, pin));
+}
+
+// also drops the gr pins that are no longer on any net
+void frRegionQuery::removeGRPins(const set<frNet*, frBlockObjectComp> &nets) {
+  Objects<frBlockObject> victims;
+  for (auto it = impl->grPins.begin(); it != impl->grPins.end(); ++it) {
+    frNet* net = nullptr;
+    if (it->second->typeId() == frcInstTerm) {
+      net = static_cast<frInstTerm*>(it->second)->getNet();
+    } else if (it->second->typeId() == frcTerm) {
+      net = static_cast<frTerm*>(it->second)->getNet();
+    }
+    if (net == nullptr || nets.find(net) != nets.end()) {
+      victims.push_back(*it);
+    }
+  }
+  for (auto &victim: victims) {
+    impl->grPins.remove(victim);
+  }
+}
+
 void frRegionQuery::Impl::add(frVia* via, ObjectsByLayer<frBlockObject> &allShapes) {
   frBox frb;
   frTransform xform;
@@ -585,6 +650,10 @@ void frRegionQuery::Impl::initDRObj(frLayerNum numLayers) {
     for (auto &via: net->getVias()) {
       addDRObj(via.get(), allShapes);
     }
+    // added by DR, so empty before its first iteration
+    for (auto &pwire: net->getPatchWires()) {
+      addDRObj(pwire.get(), allShapes);
+    }
   }
 
   for (auto i = 0; i < numLayers; i++) {
@@ -595,6 +664,27 @@ void frRegionQuery::Impl::initDRObj(frLayerNum numLayers) {
 
 }
 
+void frRegionQuery::initMarker(frLayerNum numLayers) {
+  impl->initMarker(numLayers);
+}
+
+// rebuilds the marker trees from the markers of the top block, in their order
+void frRegionQuery::Impl::initMarker(frLayerNum numLayers) {
+  markers.clear();
+  markers.resize(numLayers);
+
+  ObjectsByLayer<frMarker> allMarkers(numLayers);
+  for (auto &marker: design->getTopBlock()->getMarkers()) {
+    frBox frb;
+    marker->getBBox(frb);
+    box_t boostb(point_t(frb.left(), frb.bottom()), point_t(frb.right(), frb.top()));
+    allMarkers.at(marker->getLayerNum()).push_back(make_pair(boostb, marker.get()));
+  }
+  for (auto i = 0; i < numLayers; i++) {
+    markers.at(i) = boost::move(rtree<frMarker>(allMarkers.at(i)));
+  }
+}
+
 void frRegionQuery::print() {
   cout <<endl;
   auto& layers = impl->design->getTech()->getLayers();
@@ -47,6 +47,13 @@ namespace fr {
     void addDRObj(frShape* in);
     void addDRObj(frVia* in);
     void addMarker(frMarker* in);
+    // guides of the nets changed by an ECO, see io::Parser::postProcessGuide_eco
+    void addGuide(frGuide* in);
+    void removeGuide(frGuide* in);
+    void addOrigGuide(frNet* net, const frRect &rect);
+    void removeOrigGuides(const std::set<frNet*, frBlockObjectComp> &nets);
+    void addGRPin(frBlockObject* pin, const frPoint &pt);
+    void removeGRPins(const std::set<frNet*, frBlockObjectComp> &nets);
 
     // Queries
     void query(const frBox &box, frLayerNum layerNum, Objects<frBlockObject> &result);
@@ -72,6 +79,7 @@ namespace fr {
     void initOrigGuide(frLayerNum numLayers, std::map<frNet*, std::vector<frRect>, frBlockObjectComp> &tmpGuides);
     void initGRPin(std::vector<std::pair<frBlockObject*, frPoint> > &in);
     void initDRObj(frLayerNum numLayers);
+    void initMarker(frLayerNum numLayers);
     
     // utility
     void print();
@@ -40,8 +40,8 @@ FlexGCWorker::FlexGCWorker(frDesign* designIn, FlexDRWorker* drWorkerIn)
 FlexGCWorker::~FlexGCWorker() = default;
 
 FlexGCWorker::Impl::Impl(frDesign* designIn, FlexDRWorker* drWorkerIn, FlexGCWorker* gcWorkerIn)
-  : design(designIn), drWorker(drWorkerIn),
-    extBox(), drcBox(), owner2nets(), nets(), markers(), mapMarkers(), pwires(), rq(gcWorkerIn), printMarker(false), modifiedDRNets(),
+  : arena(), design(designIn), drWorker(drWorkerIn),
+    extBox(), drcBox(), owner2nets(), nets(), markers(), mapMarkers(), pwires(), rq(gcWorkerIn), printMarker(false), modifiedDRNets(), paProbeNets(),
     targetNet(nullptr), minLayerNum(std::numeric_limits<frLayerNum>::min()), maxLayerNum(std::numeric_limits<frLayerNum>::max()),
     targetObj(nullptr), ignoreDB(false), ignoreMinArea(false), surgicalFixEnabled(false)
 {
@@ -70,34 +70,52 @@ bool FlexGCWorker::Impl::addMarker(std::unique_ptr<frMarker> in) {
 }
 
 void FlexGCWorker::addPAObj(frConnFig* obj, frBlockObject* owner) {
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
   impl->addPAObj(obj, owner);
 }
 
 void FlexGCWorker::init()
 {
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
   impl->init();
 }
 
 int FlexGCWorker::main()
 {
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
   return impl->main();
 }
 
 void FlexGCWorker::end()
 {
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
   impl->end();
 }
 
 void FlexGCWorker::initPA0()
 {
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
   impl->initPA0();
 }
 
 void FlexGCWorker::initPA1()
 {
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
   impl->initPA1();
 }
 
+void FlexGCWorker::addPAProbe(frConnFig* obj, frBlockObject* owner)
+{
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
+  impl->addPAProbe(obj, owner);
+}
+
+void FlexGCWorker::removePAProbes()
+{
+  frArenaScope<gcBlockObject> arenaScope(&impl->arena);
+  impl->removePAProbes();
+}
+
 void FlexGCWorker::setExtBox(const frBox &in)
 {
   impl->extBox.set(in);
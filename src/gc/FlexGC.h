@@ -65,6 +65,9 @@ namespace fr {
     // initialization from FlexPA, initPA0 --> addPAObj --> initPA1
     void initPA0();
     void initPA1();
+    // incremental check from FlexPA, initPA0 --> initPA1 --> (addPAProbe --> main --> removePAProbes)*
+    void addPAProbe(frConnFig* obj, frBlockObject* owner);
+    void removePAProbes();
     void updateDRNet(drNet* net);
 
   private:
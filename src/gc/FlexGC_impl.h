@@ -100,8 +100,12 @@ namespace fr {
     // initialization from FlexPA, initPA0 --> addPAObj --> initPA1
     void initPA0();
     void initPA1();
+    // incremental check from FlexPA, initPA0 --> initPA1 --> (addPAProbe --> main --> removePAProbes)*
+    void addPAProbe(frConnFig* obj, frBlockObject* owner);
+    void removePAProbes();
     
   protected:
+    frArena                              arena; // gc objects, outlives nets
     frDesign*                            design;
     FlexDRWorker*                        drWorker;
 
@@ -120,6 +124,7 @@ namespace fr {
 
     // temps
     std::vector<drNet*>                  modifiedDRNets;
+    std::vector<gcNet*>                  paProbeNets;
 
     // parameters
     gcNet*                               targetNet;
@@ -145,6 +150,9 @@ namespace fr {
     void initDRWorker();
     void initNets();
     void initNet(gcNet* net);
+    void initNet_pin(gcNet* net, gcPin* pin, frLayerNum i,
+                     const std::vector<std::set<std::pair<frPoint, frPoint> > > &fixedPolygonEdges,
+                     const std::vector<std::set<std::pair<frPoint, frPoint> > > &fixedMaxRectangles);
     void initNet_pins_polygon(gcNet* net);
     void initNet_pins_polygonEdges(gcNet* net);
     void initNet_pins_polygonEdges_getFixedPolygonEdges(gcNet* net, std::vector<std::set<std::pair<frPoint, frPoint> > > &fixedPolygonEdges);
@@ -163,6 +171,8 @@ namespace fr {
 
     // update
     void updateGCWorker();
+    void updateNet(gcNet* net, const std::vector<gtl::polygon_90_set_data<frCoord> > &oldPolygons,
+                   const std::vector<std::vector<gtl::rectangle_data<frCoord> > > &oldRectangles);
 
     void checkMetalSpacing();
     frCoord checkMetalSpacing_getMaxSpcVal(frLayerNum layerNum);
@@ -239,6 +249,7 @@ namespace fr {
   
     // utility
     bool isCornerOverlap(gcCorner* corner, const frBox &box);
+    bool isSamePolygon(const gtl::polygon_90_with_holes_data<frCoord> &poly1, const gtl::polygon_90_with_holes_data<frCoord> &poly2);
     bool isCornerOverlap(gcCorner* corner, const gtl::rectangle_data<frCoord> &rect);
     bool isOppositeDir(gcCorner* corner, gcSegment* seg);
   };
@@ -450,10 +450,7 @@ void FlexGCWorker::Impl::initNet_pins_polygonEdges_helper_outer(gcNet* net, gcPi
       edge->setFixed(false);
       //cntRoute++;
     }
-    if (!tmpEdges.empty()) {
-      edge->setPrevEdge(tmpEdges.back().get());
-      tmpEdges.back()->setNextEdge(edge.get());
-    }
+    edge->setRing(pin->getPolygonEdges().size(), tmpEdges.size());
     tmpEdges.push_back(std::move(edge));
     bp.set(ep);
     bp1 = ep1;
@@ -475,11 +472,7 @@ void FlexGCWorker::Impl::initNet_pins_polygonEdges_helper_outer(gcNet* net, gcPi
     edge->setFixed(false);
     //cntRoute++;
   }
-  edge->setPrevEdge(tmpEdges.back().get());
-  tmpEdges.back()->setNextEdge(edge.get());
-  // set first edge
-  tmpEdges.front()->setPrevEdge(edge.get());
-  edge->setNextEdge(tmpEdges.front().get());
+  edge->setRing(pin->getPolygonEdges().size(), tmpEdges.size());
 
   tmpEdges.push_back(std::move(edge));
   // add to polygon edges
@@ -518,10 +511,7 @@ void FlexGCWorker::Impl::initNet_pins_polygonEdges_helper_inner(gcNet* net, gcPi
       edge->setFixed(false);
       //cntRoute++;
     }
-    if (!tmpEdges.empty()) {
-      edge->setPrevEdge(tmpEdges.back().get());
-      tmpEdges.back()->setNextEdge(edge.get());
-    }
+    edge->setRing(pin->getPolygonEdges().size(), tmpEdges.size());
     tmpEdges.push_back(std::move(edge));
     bp.set(ep);
     bp1 = ep1;
@@ -543,11 +533,7 @@ void FlexGCWorker::Impl::initNet_pins_polygonEdges_helper_inner(gcNet* net, gcPi
     edge->setFixed(false);
     //cntRoute++;
   }
-  edge->setPrevEdge(tmpEdges.back().get());
-  tmpEdges.back()->setNextEdge(edge.get());
-  // set first edge
-  tmpEdges.front()->setPrevEdge(edge.get());
-  edge->setNextEdge(tmpEdges.front().get());
+  edge->setRing(pin->getPolygonEdges().size(), tmpEdges.size());
   
   tmpEdges.push_back(std::move(edge));
   // add to polygon edges
@@ -581,22 +567,18 @@ void FlexGCWorker::Impl::initNet_pins_polygonEdges(gcNet* net) {
 }
 
 void FlexGCWorker::Impl::initNet_pins_polygonCorners_helper(gcNet* net, gcPin* pin) {
-  for (auto &edges: pin->getPolygonEdges()) {
+  for (int ring = 0; ring < (int)pin->getPolygonEdges().size(); ring++) {
+    auto &edges = pin->getPolygonEdges()[ring];
     vector<unique_ptr<gcCorner> > tmpCorners;
     auto prevEdge = edges.back().get();
     auto layerNum = prevEdge->getLayerNum();
-    gcCorner* prevCorner = nullptr;
     for (int i = 0; i < (int)edges.size(); i++) {
       auto nextEdge = edges[i].get();
       auto uCurrCorner = std::make_unique<gcCorner>();
       auto currCorner = uCurrCorner.get();
       tmpCorners.push_back(std::move(uCurrCorner));
-      // set edge attributes
-      prevEdge->setHighCorner(currCorner);
-      nextEdge->setLowCorner(currCorner);
-      // set currCorner attributes
-      currCorner->setPrevEdge(prevEdge);
-      currCorner->setNextEdge(nextEdge);
+      // set currCorner attributes, it sits between the edges i - 1 and i
+      currCorner->setRing(pin, ring, i);
       currCorner->x(prevEdge->high().x());
       currCorner->y(prevEdge->high().y());
       int orient = gtl::orientation(*prevEdge, *nextEdge);
@@ -643,17 +625,8 @@ void FlexGCWorker::Impl::initNet_pins_polygonCorners_helper(gcNet* net, gcPin* p
       }
       // currCorner->setFixed(prevEdge->isFixed() && nextEdge->isFixed());
 
-      if (prevCorner) {
-        prevCorner->setNextCorner(currCorner);
-        currCorner->setPrevCorner(prevCorner);
-      }
-      prevCorner = currCorner;
       prevEdge = nextEdge;
     }
-    // update attributes between first and last corners
-    auto currCorner = tmpCorners.front().get();
-    prevCorner->setNextCorner(currCorner);
-    currCorner->setPrevCorner(prevCorner);
     // add to polygon corners
     pin->addPolygonCorners(tmpCorners);
   }
@@ -727,6 +700,98 @@ void FlexGCWorker::Impl::initNet_pins_maxRectangles(gcNet* net) {
   }
 }
 
+bool FlexGCWorker::Impl::isSamePolygon(const gtl::polygon_90_with_holes_data<frCoord> &poly1,
+                                       const gtl::polygon_90_with_holes_data<frCoord> &poly2) {
+  if (poly1.size() != poly2.size() || poly1.size_holes() != poly2.size_holes() ||
+      !std::equal(poly1.begin(), poly1.end(), poly2.begin())) {
+    return false;
+  }
+  auto holeIt2 = poly2.begin_holes();
+  for (auto holeIt1 = poly1.begin_holes(); holeIt1 != poly1.end_holes(); holeIt1++, holeIt2++) {
+    if (holeIt1->size() != holeIt2->size() || !std::equal(holeIt1->begin(), holeIt1->end(), holeIt2->begin())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void FlexGCWorker::Impl::initNet_pin(gcNet* net, gcPin* pin, frLayerNum i,
+                                     const vector<set<pair<frPoint, frPoint> > > &fixedPolygonEdges,
+                                     const vector<set<pair<frPoint, frPoint> > > &fixedMaxRectangles) {
+  auto poly = pin->getPolygon();
+  initNet_pins_polygonEdges_helper_outer(net, pin, poly, i, fixedPolygonEdges);
+  for (auto holeIt = poly->begin_holes(); holeIt != poly->end_holes(); holeIt++) {
+    initNet_pins_polygonEdges_helper_inner(net, pin, *holeIt, i, fixedPolygonEdges);
+  }
+  initNet_pins_polygonCorners_helper(net, pin);
+  vector<gtl::rectangle_data<frCoord> > rects;
+  gtl::get_max_rectangles(rects, *poly);
+  for (auto &rect: rects) {
+    initNet_pins_maxRectangles_helper(net, pin, rect, i, fixedMaxRectangles);
+  }
+}
+
+// same result as clear() + initNet(), but layers whose route shapes did not change keep their pins,
+// and on the other layers a pin with an unchanged polygon is kept with its edges, corners and max rectangles
+void FlexGCWorker::Impl::updateNet(gcNet* net, const vector<gtl::polygon_90_set_data<frCoord> > &oldPolygons,
+                                   const vector<vector<gtl::rectangle_data<frCoord> > > &oldRectangles) {
+  int numLayers = getDesign()->getTech()->getLayers().size();
+  if (!net->hasFixedShapeCache()) {
+    vector<set<pair<frPoint, frPoint> > > fixedPolygonEdges(numLayers);
+    vector<set<pair<frPoint, frPoint> > > fixedMaxRectangles(numLayers);
+    initNet_pins_polygonEdges_getFixedPolygonEdges(net, fixedPolygonEdges);
+    initNet_pins_maxRectangles_getFixedMaxRectangles(net, fixedMaxRectangles);
+    net->setFixedCache(fixedPolygonEdges, fixedMaxRectangles);
+  }
+  auto &fixedPolygonEdges  = net->getFixedPolygonEdges();
+  auto &fixedMaxRectangles = net->getFixedMaxRectangles();
+
+  vector<unique_ptr<gcPin> > oldPins;
+  vector<gtl::polygon_90_with_holes_data<frCoord> > shapes;
+  for (int i = 0; i < numLayers; i++) {
+    // concave corners look at the route rectangles of the layer, pins are only kept when they are unchanged
+    bool isSameRect = (net->getRectangles(i, false) == oldRectangles[i]);
+    if (isSameRect && net->getPolygons(i, false) == oldPolygons[i]) {
+      continue;
+    }
+    net->takePins(i, oldPins);
+    // same pin order as initNet_pins_polygon
+    shapes.clear();
+    {
+      gtl::polygon_90_set_data<frCoord> layerPoly;
+      using namespace gtl::operators;
+      layerPoly += net->getPolygons(i, false);
+      layerPoly += net->getPolygons(i, true);
+      layerPoly.get(shapes);
+    }
+    for (auto isFixed: {false, true}) {
+      for (auto &rect: net->getRectangles(i, isFixed)) {
+        gtl::polygon_90_with_holes_data<frCoord> shape;
+        std::vector<frCoord> coords = {gtl::xl(rect), gtl::yl(rect), gtl::xh(rect), gtl::yh(rect)};
+        shape.set_compact(coords.begin(), coords.end());
+        shapes.push_back(shape);
+      }
+    }
+    for (auto &shape: shapes) {
+      bool isReused = false;
+      if (isSameRect) {
+        for (auto &oldPin: oldPins) {
+          if (oldPin && isSamePolygon(*(oldPin->getPolygon()), shape)) {
+            net->addPin(std::move(oldPin), i);
+            isReused = true;
+            break;
+          }
+        }
+      }
+      if (!isReused) {
+        net->addPin(shape, i);
+        initNet_pin(net, net->getPins(i).back().get(), i, fixedPolygonEdges, fixedMaxRectangles);
+      }
+    }
+    oldPins.clear();
+  }
+}
+
 void FlexGCWorker::Impl::initNet(gcNet* net) {
   initNet_pins_polygon(net);
   initNet_pins_polygonEdges(net);
@@ -819,6 +884,31 @@ void FlexGCWorker::Impl::initPA1() {
   initRegionQuery();
 }
 
+// adds a route obj to an initialized worker and rebuilds only its owner net
+void FlexGCWorker::Impl::addPAProbe(frConnFig* obj, frBlockObject* owner) {
+  addPAObj(obj, owner);
+  auto net = owner2nets[owner];
+  getWorkerRegionQuery().removeFromRegionQuery(net);
+  net->clearPins();
+  initNet(net);
+  getWorkerRegionQuery().addToRegionQuery(net);
+  if (std::find(paProbeNets.begin(), paProbeNets.end(), net) == paProbeNets.end()) {
+    paProbeNets.push_back(net);
+  }
+}
+
+// restores the probed nets to their fixed shapes only
+void FlexGCWorker::Impl::removePAProbes() {
+  for (auto net: paProbeNets) {
+    getWorkerRegionQuery().removeFromRegionQuery(net);
+    net->clear();
+    initNet(net);
+    getWorkerRegionQuery().addToRegionQuery(net);
+  }
+  paProbeNets.clear();
+  clearMarkers();
+}
+
 void FlexGCWorker::Impl::updateGCWorker() {
   if (!getDRWorker()) {
     cout <<"Error: updateGCWorker expects a valid DRWorker" <<endl;
@@ -840,10 +930,14 @@ void FlexGCWorker::Impl::updateGCWorker() {
   }
 
   // start init from dr objs
+  vector<vector<gtl::polygon_90_set_data<frCoord> > > oldPolygons(fnets.size());
+  vector<vector<vector<gtl::rectangle_data<frCoord> > > > oldRectangles(fnets.size());
+  int idx = 0;
   for (auto fnet: fnets) {
     auto net = owner2nets[fnet];
     getWorkerRegionQuery().removeFromRegionQuery(net); // delete all region queries
-    net->clear();               // delete all pins and routeXXX
+    net->takeRoute(oldPolygons[idx], oldRectangles[idx]); // pins are updated in updateNet
+    idx++;
     // re-init gcnet from drobjs
     auto vecptr = getDRWorker()->getDRNets(fnet);
     if (vecptr) {
@@ -872,11 +966,13 @@ void FlexGCWorker::Impl::updateGCWorker() {
   }
 
   // init
+  idx = 0;
   for (auto fnet: fnets) {
     auto net = owner2nets[fnet];
-    // init gc net
-    initNet(net);
+    // update gc net
+    updateNet(net, oldPolygons[idx], oldRectangles[idx]);
     getWorkerRegionQuery().addToRegionQuery(net);
+    idx++;
   }
 }
 
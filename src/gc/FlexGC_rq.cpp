@@ -35,13 +35,71 @@ using namespace fr;
 
 struct FlexGCWorkerRegionQuery::Impl
 {
-  void addPolygonEdge(gcSegment* edge, std::vector<std::vector<std::pair<segment_t, gcSegment*> > > &allShapes);
-  void addMaxRectangle(gcRect* rect, std::vector<std::vector<rq_box_value_t<gcRect*>>> &allShapes);
+  // the trees hold a 32-bit slot into a per-layer table instead of the object
+  // pointer, the slot is kept in the id of the object
+  template <typename T>
+  struct SlotTable {
+    std::vector<T*>       objs;
+    std::vector<uint32_t> freeSlots;
+    uint32_t add(T* obj) {
+      uint32_t slot;
+      if (freeSlots.empty()) {
+        slot = objs.size();
+        objs.push_back(obj);
+      } else {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        objs[slot] = obj;
+      }
+      obj->setId(slot);
+      return slot;
+    }
+    void remove(T* obj) {
+      objs[obj->getId()] = nullptr;
+      freeSlots.push_back(obj->getId());
+    }
+    void clear() {
+      objs.clear();
+      freeSlots.clear();
+    }
+  };
+  // turns the slot of each tree value back into its object while the
+  // query writes the result
+  template <typename Value, typename T>
+  struct SlotOutputIterator {
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = void;
+    using pointer           = void;
+    using reference         = void;
+    std::vector<std::pair<typename Value::first_type, T*> >* result;
+    const SlotTable<T>* table;
+    SlotOutputIterator& operator=(const Value &value) {
+      result->emplace_back(value.first, table->objs[value.second]);
+      return *this;
+    }
+    SlotOutputIterator& operator*() {
+      return *this;
+    }
+    SlotOutputIterator& operator++() {
+      return *this;
+    }
+    SlotOutputIterator& operator++(int) {
+      return *this;
+    }
+  };
+  typedef std::pair<segment_t, uint32_t> edge_value_t;
+  typedef rq_box_value_t<uint32_t>       rect_value_t;
+
+  void addPolygonEdge(gcSegment* edge, std::vector<std::vector<edge_value_t> > &allShapes);
+  void addMaxRectangle(gcRect* rect, std::vector<std::vector<rect_value_t> > &allShapes);
   void init(int numLayers);
 
   FlexGCWorker* gcWorker;
-  std::vector<bgi::rtree<std::pair<segment_t, gcSegment*>, bgi::quadratic<16> > > polygon_edges; // merged
-  std::vector<bgi::rtree<rq_box_value_t<gcRect*>,          bgi::quadratic<16> > > max_rectangles; // merged
+  std::vector<bgi::rtree<edge_value_t, bgi::quadratic<16> > > polygon_edges; // merged
+  std::vector<bgi::rtree<rect_value_t, bgi::quadratic<16> > > max_rectangles; // merged
+  std::vector<SlotTable<gcSegment> > edgeSlots;
+  std::vector<SlotTable<gcRect> >    rectSlots;
 
 };
 
@@ -58,36 +116,43 @@ FlexGCWorker* FlexGCWorkerRegionQuery::getGCWorker() const {
 
 void FlexGCWorkerRegionQuery::addPolygonEdge(gcSegment* edge) {
   segment_t boosts(point_t(edge->low().x(), edge->low().y()), point_t(edge->high().x(), edge->high().y()));
-  impl->polygon_edges[edge->getLayerNum()].insert(make_pair(boosts, edge));
+  auto slot = impl->edgeSlots[edge->getLayerNum()].add(edge);
+  impl->polygon_edges[edge->getLayerNum()].insert(make_pair(boosts, slot));
 }
 
-void FlexGCWorkerRegionQuery::Impl::addPolygonEdge(gcSegment* edge, vector<vector<pair<segment_t, gcSegment*> > > &allShapes) {
+void FlexGCWorkerRegionQuery::Impl::addPolygonEdge(gcSegment* edge, vector<vector<edge_value_t> > &allShapes) {
   segment_t boosts(point_t(edge->low().x(), edge->low().y()), point_t(edge->high().x(), edge->high().y()));
-  allShapes[edge->getLayerNum()].push_back(make_pair(boosts, edge));
+  auto slot = edgeSlots[edge->getLayerNum()].add(edge);
+  allShapes[edge->getLayerNum()].push_back(make_pair(boosts, slot));
 }
 
 void FlexGCWorkerRegionQuery::addMaxRectangle(gcRect* rect) {
-  box_t boostb(point_t(gtl::xl(*rect), gtl::yl(*rect)), point_t(gtl::xh(*rect), gtl::yh(*rect)));
-  impl->max_rectangles[rect->getLayerNum()].insert(make_pair(boostb, rect));
+  frBox box(gtl::xl(*rect), gtl::yl(*rect), gtl::xh(*rect), gtl::yh(*rect));
+  auto slot = impl->rectSlots[rect->getLayerNum()].add(rect);
+  impl->max_rectangles[rect->getLayerNum()].insert(make_pair(box, slot));
 }
 
-void FlexGCWorkerRegionQuery::Impl::addMaxRectangle(gcRect* rect, vector<vector<rq_box_value_t<gcRect*>>> &allShapes) {
-  box_t boostb(point_t(gtl::xl(*rect), gtl::yl(*rect)), point_t(gtl::xh(*rect), gtl::yh(*rect)));
-  allShapes[rect->getLayerNum()].push_back(make_pair(boostb, rect));
+void FlexGCWorkerRegionQuery::Impl::addMaxRectangle(gcRect* rect, vector<vector<rect_value_t> > &allShapes) {
+  frBox box(gtl::xl(*rect), gtl::yl(*rect), gtl::xh(*rect), gtl::yh(*rect));
+  auto slot = rectSlots[rect->getLayerNum()].add(rect);
+  allShapes[rect->getLayerNum()].push_back(make_pair(box, slot));
 }
 
 void FlexGCWorkerRegionQuery::removePolygonEdge(gcSegment* edge) {
   segment_t boosts(point_t(edge->low().x(), edge->low().y()), point_t(edge->high().x(), edge->high().y()));
-  impl->polygon_edges[edge->getLayerNum()].remove(make_pair(boosts, edge));
+  impl->polygon_edges[edge->getLayerNum()].remove(make_pair(boosts, (uint32_t)edge->getId()));
+  impl->edgeSlots[edge->getLayerNum()].remove(edge);
 }
 
 void FlexGCWorkerRegionQuery::removeMaxRectangle(gcRect* rect) {
-  box_t boostb(point_t(gtl::xl(*rect), gtl::yl(*rect)), point_t(gtl::xh(*rect), gtl::yh(*rect)));
-  impl->max_rectangles[rect->getLayerNum()].remove(make_pair(boostb, rect));
+  frBox box(gtl::xl(*rect), gtl::yl(*rect), gtl::xh(*rect), gtl::yh(*rect));
+  impl->max_rectangles[rect->getLayerNum()].remove(make_pair(box, (uint32_t)rect->getId()));
+  impl->rectSlots[rect->getLayerNum()].remove(rect);
 }
 
 void FlexGCWorkerRegionQuery::queryPolygonEdge(const box_t &box, frLayerNum layerNum, vector<pair<segment_t, gcSegment*> > &result) {
-  impl->polygon_edges[layerNum].query(bgi::intersects(box), back_inserter(result));
+  Impl::SlotOutputIterator<Impl::edge_value_t, gcSegment> out{&result, &impl->edgeSlots[layerNum]};
+  impl->polygon_edges[layerNum].query(bgi::intersects(box), out);
 }
 
 void FlexGCWorkerRegionQuery::queryPolygonEdge(const frBox &box, frLayerNum layerNum, vector<pair<segment_t, gcSegment*> > &result) {
@@ -96,7 +161,8 @@ void FlexGCWorkerRegionQuery::queryPolygonEdge(const frBox &box, frLayerNum laye
 }
 
 void FlexGCWorkerRegionQuery::queryMaxRectangle(const box_t &box, frLayerNum layerNum, std::vector<rq_box_value_t<gcRect*> > &result) {
-  impl->max_rectangles[layerNum].query(bgi::intersects(box), back_inserter(result));
+  Impl::SlotOutputIterator<Impl::rect_value_t, gcRect> out{&result, &impl->rectSlots[layerNum]};
+  impl->max_rectangles[layerNum].query(bgi::intersects(box), out);
 }
 
 void FlexGCWorkerRegionQuery::queryMaxRectangle(const frBox &box, frLayerNum layerNum, std::vector<rq_box_value_t<gcRect*> > &result) {
@@ -120,9 +186,13 @@ void FlexGCWorkerRegionQuery::Impl::init(int numLayers) {
   polygon_edges.resize(numLayers);
   max_rectangles.clear();
   max_rectangles.resize(numLayers);
+  edgeSlots.clear();
+  edgeSlots.resize(numLayers);
+  rectSlots.clear();
+  rectSlots.resize(numLayers);
   
-  vector<vector<pair<segment_t, gcSegment*>>> allPolygonEdges(numLayers);
-  vector<vector<rq_box_value_t<gcRect*>>> allMaxRectangles(numLayers);
+  vector<vector<edge_value_t>> allPolygonEdges(numLayers);
+  vector<vector<rect_value_t>> allMaxRectangles(numLayers);
 
   int cntPolygonEdge  = 0;
   int cntMaxRectangle = 0;
@@ -146,8 +216,8 @@ void FlexGCWorkerRegionQuery::Impl::init(int numLayers) {
   int cntRTPolygonEdge  = 0;
   int cntRTMaxRectangle = 0;
   for (int i = 0; i < numLayers; i++) {
-    polygon_edges[i]  = boost::move(bgi::rtree<pair<segment_t, gcSegment*>, bgi::quadratic<16>>(allPolygonEdges[i]));
-    max_rectangles[i] = boost::move(bgi::rtree<rq_box_value_t<gcRect*>, bgi::quadratic<16>>(allMaxRectangles[i]));
+    polygon_edges[i]  = boost::move(bgi::rtree<edge_value_t, bgi::quadratic<16>>(allPolygonEdges[i]));
+    max_rectangles[i] = boost::move(bgi::rtree<rect_value_t, bgi::quadratic<16>>(allMaxRectangles[i]));
     cntRTPolygonEdge  += polygon_edges[i].size();
     cntRTMaxRectangle += max_rectangles[i].size();
   }
@@ -155,7 +225,8 @@ void FlexGCWorkerRegionQuery::Impl::init(int numLayers) {
     for (int i = 0; i < numLayers; i++) {
       frPoint bp, ep;
       double dbu = gcWorker->getDesign()->getTopBlock()->getDBUPerUU();
-      for (auto &[seg, ptr]: polygon_edges[i]) {
+      for (auto &[seg, slot]: polygon_edges[i]) {
+        auto ptr = edgeSlots[i].objs[slot];
         //ptr->getPoints(bp, ep);
         cout <<"polyEdge ";
         if (ptr->isFixed()) {
@@ -192,7 +263,8 @@ void FlexGCWorkerRegionQuery::Impl::init(int numLayers) {
   if (enableOutput) {
     for (int i = 0; i < numLayers; i++) {
       double dbu = gcWorker->getDesign()->getTopBlock()->getDBUPerUU();
-      for (auto &[box, ptr]: max_rectangles[i]) {
+      for (auto &[box, slot]: max_rectangles[i]) {
+        auto ptr = rectSlots[i].objs[slot];
         cout <<"maxRect ";
         if (ptr->isFixed()) {
           cout <<"FIXED";
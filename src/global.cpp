@@ -41,6 +41,13 @@ string OUT_FILE;
 string REF_OUT_FILE;
 string OUT_MAZE_FILE;
 string DRC_RPT_FILE;
+string RP_CACHE_DIR;
+string DESIGN_SNAPSHOT_FILE;
+string DR_CHECKPOINT_FILE;
+string DR_RESTART_FILE;
+string METRICS_FILE;
+string DR_DIST_LISTEN;
+string DR_DIST_LEADER;
 
 // to be removed
 int OR_SEED = -1;
@@ -50,6 +57,8 @@ string DBPROCESSNODE = "";
 int    MAX_THREADS   = 1;
 int    BATCHSIZE     = 1024;
 int    BATCHSIZETA   = 8;
+int    DR_WORKER_REPORT = 0;
+int    DR_DIST_WORKERS = 0;
 int    MTSAFEDIST    = 2000;
 int    DRCSAFEDIST   = 500;
 int    VERBOSE       = 1;
@@ -61,6 +70,8 @@ bool   USEMINSPACING_OBS = true;
 bool   RESERVE_VIA_ACCESS = true;
 bool   ENABLE_BOUNDARY_MAR_FIX = true;
 bool   ENABLE_VIA_GEN = true;
+bool   DETERMINISTIC = false;
+bool   DR_NUMA = false;
 
 frLayerNum VIAINPIN_BOTTOMLAYERNUM             = std::numeric_limits<frLayerNum>::max();
 frLayerNum VIAINPIN_TOPLAYERNUM                = std::numeric_limits<frLayerNum>::max();
@@ -78,6 +89,12 @@ frLayerNum ONGRIDONLY_VIA_TOPLAYERNUM             = std::numeric_limits<frLayerN
 frLayerNum VIA_ACCESS_LAYERNUM = 2;
 
 int END_ITERATION = 80;
+int DR_CHECKPOINT_INTERVAL = 5;
+vector<frDRIterParam> DR_SCHEDULE;
+int DR_STOP_VIOLATIONS = -1;
+int DR_STALL_WINDOW = 0;
+float DR_STALL_IMPROVEMENT = 0.05;
+string DR_STALL_POLICY = "stop";
 
 frUInt4 TAVIACOST       = 1;
 frUInt4 TAPINCOST       = 4;
@@ -32,9 +32,23 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 #include "frDesign.h"
 #include "db/obj/frBlock.h"
 
+namespace fr {
+  // one searchRepair call of the detailed routing schedule
+  struct frDRIterParam {
+    int     size;
+    int     offset;
+    int     mazeEndIter;
+    frUInt4 drcCost;
+    frUInt4 markerCost;
+    int     ripupMode;
+    bool    followGuide;
+  };
+}
+
 extern std::string DEF_FILE;
 extern std::string GUIDE_FILE;
 extern std::string OUTGUIDE_FILE;
@@ -45,6 +59,14 @@ extern std::string REF_OUT_FILE;
 extern std::string DBPROCESSNODE;
 extern std::string OUT_MAZE_FILE;
 extern std::string DRC_RPT_FILE;
+extern std::string RP_CACHE_DIR;
+extern std::string DESIGN_SNAPSHOT_FILE;
+extern std::string DR_CHECKPOINT_FILE;
+extern std::string DR_RESTART_FILE;
+extern std::string METRICS_FILE;
+// distributed DR, addresses are unix:<path> or <host>:<port>
+extern std::string DR_DIST_LISTEN; // leader
+extern std::string DR_DIST_LEADER; // worker processes
 // to be removed
 extern int OR_SEED;
 extern double OR_K;
@@ -52,6 +74,8 @@ extern double OR_K;
 extern int MAX_THREADS ;
 extern int BATCHSIZE ;
 extern int BATCHSIZETA;
+extern int DR_WORKER_REPORT; // number of slowest workers reported per iteration, 0 = off
+extern int DR_DIST_WORKERS; // worker processes the leader waits for
 extern int MTSAFEDIST ;
 extern int DRCSAFEDIST ;
 extern int VERBOSE     ;
@@ -63,6 +87,8 @@ extern bool USEMINSPACING_OBS;
 extern bool RESERVE_VIA_ACCESS;
 extern bool ENABLE_BOUNDARY_MAR_FIX;
 extern bool ENABLE_VIA_GEN;
+extern bool DETERMINISTIC; // same output for any number of threads
+extern bool DR_NUMA; // pin DR threads to NUMA nodes and give each node a stripe of clips
 //extern int TEST;
 extern fr::frLayerNum VIAINPIN_BOTTOMLAYERNUM;
 extern fr::frLayerNum VIAINPIN_TOPLAYERNUM;
@@ -83,6 +109,13 @@ extern int MINNUMACCESSPOINT_STDCELLPIN;
 extern int ACCESS_PATTERN_END_ITERATION_NUM;
 
 extern int END_ITERATION;
+extern int DR_CHECKPOINT_INTERVAL;
+// empty uses the built-in schedule of FlexDR::main
+extern std::vector<fr::frDRIterParam> DR_SCHEDULE;
+extern int DR_STOP_VIOLATIONS;
+extern int DR_STALL_WINDOW;
+extern float DR_STALL_IMPROVEMENT;
+extern std::string DR_STALL_POLICY;
 
 extern fr::frUInt4 TAVIACOST;
 extern fr::frUInt4 TAPINCOST;
@@ -30,6 +30,15 @@
 #include <fstream>
 #include <sstream>
 #include <exception>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <fcntl.h>
+#include <omp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "frProfileTask.h"
 #include "global.h"
@@ -38,6 +47,9 @@
 
 #include "defrReader.hpp"
 #include "lefrReader.hpp"
+#include "defzlib.hpp"
+#include "lefzlib.hpp"
+#include "io/io_gzip.h"
 
 using namespace std;
 using namespace fr;
@@ -419,7 +431,8 @@ int io::Parser::Callbacks::getDefComponents(defrCallbackType_e type, defiCompone
   }
 
   io::Parser* parser = (io::Parser*) data;
-  if (parser->design->name2refBlock.find(comp->name()) == parser->design->name2refBlock.end()) {
+  auto refBlockIt = parser->design->name2refBlock.find(comp->name());
+  if (refBlockIt == parser->design->name2refBlock.end()) {
     if (VERBOSE > -1) {
       cout <<"Error: library cell not found!" <<endl;
     }
@@ -432,7 +445,7 @@ int io::Parser::Callbacks::getDefComponents(defrCallbackType_e type, defiCompone
   }
 
   
-  frBlock* refBlock = parser->design->name2refBlock.at(comp->name());
+  frBlock* refBlock = refBlockIt->second;
   auto uInst = make_unique<frInst>(comp->id(), refBlock);
   auto tmpInst = uInst.get();
   tmpInst->setId(parser->numInsts);
@@ -456,7 +469,7 @@ int io::Parser::Callbacks::getDefComponents(defrCallbackType_e type, defiCompone
     tmpInst->addInstBlockage(std::move(instBlk));
   }
 
-  if (parser->tmpBlock->name2inst.find(comp->id()) != parser->tmpBlock->name2inst.end()) {
+  if (parser->tmpBlock->getInst(comp->id()) != nullptr) {
     if (VERBOSE > -1) {
       cout <<"Error: same cell name!" <<endl;
     }
@@ -565,13 +578,13 @@ int io::Parser::Callbacks::getDefNets(defrCallbackType_e type, defiNet* net, def
     
     if (!strcmp(net->instance(i), "PIN")) {
       // IOs
-      if (parser->tmpBlock->name2term.find(net->pin(i)) == parser->tmpBlock->name2term.end()) {
+      auto term = parser->tmpBlock->getTerm(net->pin(i)); // frTerm*
+      if (term == nullptr) {
         if (VERBOSE > -1) {
           cout <<"Error: term not found!" <<endl;
         }
         exit(1);
       }
-      auto term = parser->tmpBlock->name2term[net->pin(i)]; // frTerm*
       term->addToNet(netIn);
       netIn->addTerm(term);
     } else {
@@ -580,8 +593,7 @@ int io::Parser::Callbacks::getDefNets(defrCallbackType_e type, defiNet* net, def
         for (auto &inst: parser->tmpBlock->getInsts()) {
           for (auto &uInstTerm: inst->getInstTerms()) {
             auto instTerm = uInstTerm.get();
-            auto name = instTerm->getTerm()->getName();
-            if (name == frString(net->pin(i))) {
+            if (instTerm->getTerm()->getName() == net->pin(i)) {
               instTerm->addToNet(netIn);
               netIn->addInstTerm(instTerm);
               break;
@@ -589,18 +601,17 @@ int io::Parser::Callbacks::getDefNets(defrCallbackType_e type, defiNet* net, def
           }
         }
       } else {
-        if (parser->tmpBlock->name2inst.find(net->instance(i)) == parser->tmpBlock->name2inst.end()) {
+        auto inst = parser->tmpBlock->getInst(net->instance(i)); //frInst*
+        if (inst == nullptr) {
           if (VERBOSE > -1) {
             cout <<"Error: component not found!" <<endl;
           }
           exit(1);
         }
-        auto inst = parser->tmpBlock->name2inst[net->instance(i)]; //frInst*
         bool flag =   false;
         for (auto &uInstTerm: inst->getInstTerms()) {
           auto instTerm = uInstTerm.get();
-          auto name = instTerm->getTerm()->getName();
-          if (name == frString(net->pin(i))) {
+          if (instTerm->getTerm()->getName() == net->pin(i)) {
             flag = true;
             instTerm->addToNet(netIn);
             netIn->addInstTerm(instTerm);
@@ -1055,6 +1066,29 @@ int io::Parser::Callbacks::getDefTracks(defrCallbackType_e type, defiTrack* trac
   return 0;
 }
 
+// section counts, used to size the containers and name indices up front
+int io::Parser::Callbacks::getDefInteger(defrCallbackType_e type, int number, defiUserData data) {
+  io::Parser* parser = (io::Parser*) data;
+  auto &tmpBlock = parser->tmpBlock;
+  if (tmpBlock == nullptr || number <= 0) {
+    return 0;
+  }
+  if (type == defrComponentStartCbkType) {
+    tmpBlock->insts.reserve(number);
+    tmpBlock->name2inst.reserve(number);
+  } else if (type == defrStartPinsCbkType) {
+    tmpBlock->terms.reserve(number);
+    tmpBlock->name2term.reserve(number);
+  } else if (type == defrNetStartCbkType) {
+    tmpBlock->nets.reserve(number);
+    tmpBlock->name2net.reserve(number);
+  } else if (type == defrSNetStartCbkType) {
+    tmpBlock->snets.reserve(number);
+    tmpBlock->name2snet.reserve(number);
+  }
+  return 0;
+}
+
 int io::Parser::Callbacks::getDefUnits(defrCallbackType_e type, double number, defiUserData data) {
   //bool enableOutput = true;
   bool enableOutput = false;
@@ -1083,25 +1117,39 @@ void io::Parser::readDef() {
   defrSetDieAreaCbk(Callbacks::getDefDieArea);
   defrSetUnitsCbk(Callbacks::getDefUnits);
   defrSetTrackCbk(Callbacks::getDefTracks);
+  defrSetComponentStartCbk(Callbacks::getDefInteger);
   defrSetComponentCbk(Callbacks::getDefComponents);
+  defrSetStartPinsCbk(Callbacks::getDefInteger);
   defrSetPinCbk(Callbacks::getDefTerminals);
+  defrSetSNetStartCbk(Callbacks::getDefInteger);
   defrSetSNetCbk(Callbacks::getDefNets);
+  defrSetNetStartCbk(Callbacks::getDefInteger);
   defrSetNetCbk(Callbacks::getDefNets);
   defrSetAddPathToNet();
   defrSetViaCbk(Callbacks::getDefVias);
   defrSetBlockageCbk(Callbacks::getDefBlockages);
 
-  if ((f = fopen(DEF_FILE.c_str(),"r")) == 0) {
-    cout <<"Couldn't open def file" <<endl;
-    exit(2);
+  if (isGzipFile(DEF_FILE)) {
+    // inflated block by block through the parser's read function
+    defGZFile gzf = defGZipOpen(DEF_FILE.c_str(), "r");
+    if (gzf == 0) {
+      cout <<"Couldn't open def file" <<endl;
+      exit(2);
+    }
+    res = defrReadGZip(gzf, DEF_FILE.c_str(), (defiUserData)this);
+    defGZipClose(gzf);
+  } else {
+    if ((f = fopen(DEF_FILE.c_str(),"r")) == 0) {
+      cout <<"Couldn't open def file" <<endl;
+      exit(2);
+    }
+    res = defrRead(f, DEF_FILE.c_str(), (defiUserData)this, 1);
+    fclose(f);
   }
-
-  res = defrRead(f, DEF_FILE.c_str(), (defiUserData)this, 1);
   if (res != 0) {
     cout <<"DEF parser returns an error!" <<endl;
     exit(2);
   }
-  fclose(f);
 
   defrClear();
 
@@ -4822,17 +4870,26 @@ void io::Parser::readLef() {
   lefrSetViaCbk(Callbacks::getLefVias);
   lefrSetViaRuleCbk(Callbacks::getLefViaRules);
 
-  if ((f = fopen(LEF_FILE.c_str(),"r")) == 0) {
-    cout <<"Couldn't open lef file" <<endl;
-    exit(2);
+  if (isGzipFile(LEF_FILE)) {
+    lefGZFile gzf = lefGZipOpen(LEF_FILE.c_str(), "r");
+    if (gzf == 0) {
+      cout <<"Couldn't open lef file" <<endl;
+      exit(2);
+    }
+    res = lefrReadGZip(gzf, LEF_FILE.c_str(), (lefiUserData)this);
+    lefGZipClose(gzf);
+  } else {
+    if ((f = fopen(LEF_FILE.c_str(),"r")) == 0) {
+      cout <<"Couldn't open lef file" <<endl;
+      exit(2);
+    }
+    res = lefrRead(f, LEF_FILE.c_str(), (lefiUserData)this);
+    fclose(f);
   }
-
-  res = lefrRead(f, LEF_FILE.c_str(), (lefiUserData)this);
   if (res != 0) {
     cout <<"LEF parser returns an error!" <<endl;
     exit(2);
   }
-  fclose(f);
 
   lefrClear();
 }
@@ -4856,7 +4913,7 @@ void io::Parser::readLefDef() {
     cout <<"#viarulegen: " <<tech->viaRuleGenerates.size() <<endl;
   }
 
-  auto numLefVia = tech->vias.size();
+  numLefVias = tech->vias.size();
 
   //tech->printAllConstraints();
   
@@ -4882,7 +4939,7 @@ void io::Parser::readLefDef() {
     cout <<"design:      " <<design->getTopBlock()->getName()    <<endl;
     cout <<"die area:    " <<dieBox                              <<endl;
     cout <<"trackPts:    " <<design->getTopBlock()->getTrackPatterns().size() <<endl;
-    cout <<"defvias:     " <<tech->vias.size() - numLefVia       <<endl;
+    cout <<"defvias:     " <<tech->vias.size() - numLefVias      <<endl;
     cout <<"#components: " <<design->getTopBlock()->insts.size() <<endl;
     cout <<"#terminals:  " <<design->getTopBlock()->terms.size() <<endl;
     cout <<"#snets:      " <<design->getTopBlock()->snets.size() <<endl;
@@ -4905,62 +4962,124 @@ void io::Parser::readLefDef() {
 
 }
 
-void io::Parser::readGuide() {
-  ProfileTask profile("IO:readGuide");
+namespace {
+  // guides of one net block, in file order
+  typedef vector<pair<frNet*, vector<frRect> > > guideShard;
 
-  if (VERBOSE > 0) {
-    cout <<endl <<"reading guide ..." <<endl;
-  }
+  struct guideLookup {
+    const frBlock*                     block;
+    unordered_map<string, frLayerNum>  name2layer;
+  };
 
-  int numGuides = 0;
+  bool isGuideSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+  }
 
-  string netName = "";
-  frNet* net = nullptr;
+  // true for the ")" line closing a net block
+  bool isGuideNetEnd(const char* lineBegin, const char* lineEnd) {
+    while (lineBegin < lineEnd && isGuideSpace(*lineBegin)) {
+      lineBegin++;
+    }
+    if (lineBegin == lineEnd || *lineBegin != ')') {
+      return false;
+    }
+    for (lineBegin++; lineBegin < lineEnd; lineBegin++) {
+      if (!isGuideSpace(*lineBegin) && *lineBegin != '\n') {
+        return false;
+      }
+    }
+    return true;
+  }
 
-  ifstream fin(GUIDE_FILE.c_str());
-  string line;
-  frBox  box;
-  frLayerNum layerNum;
+  // end of the first net block closing at or after pos
+  const char* nextGuideNetEnd(const char* pos, const char* begin, const char* end) {
+    if (pos <= begin) {
+      return begin;
+    }
+    while (pos < end && *(pos - 1) != '\n') {
+      pos++;
+    }
+    while (pos < end) {
+      const char* lineEnd = static_cast<const char*>(memchr(pos, '\n', end - pos));
+      lineEnd = lineEnd ? lineEnd + 1 : end;
+      if (isGuideNetEnd(pos, lineEnd)) {
+        return lineEnd;
+      }
+      pos = lineEnd;
+    }
+    return end;
+  }
 
-  if (fin.is_open()){
-    while (fin.good()) {
-      getline(fin, line);
-      //cout <<line <<endl <<line.size() <<endl;
-      if (line == "(" || line == "") continue;
-      if (line == ")") {
-        continue;
+  // end of the last complete net block in [begin, end)
+  const char* lastGuideNetEnd(const char* begin, const char* end) {
+    const char* lineEnd = end;
+    while (lineEnd > begin && *(lineEnd - 1) != '\n') {
+      lineEnd--;
+    }
+    while (lineEnd > begin) {
+      const char* lineBegin = lineEnd - 1;
+      while (lineBegin > begin && *(lineBegin - 1) != '\n') {
+        lineBegin--;
       }
+      if (isGuideNetEnd(lineBegin, lineEnd)) {
+        return lineEnd;
+      }
+      lineEnd = lineBegin;
+    }
+    return begin;
+  }
 
-      stringstream ss(line);
-      string word = "";
-      vector<string> vLine;
-      while (!ss.eof()) {
-        ss >>word;
-        vLine.push_back(word);
-        //cout <<word <<" ";
+  void readGuide_range(const char* begin, const char* end, const guideLookup &lookup,
+                       frTechObject* tech, guideShard &shard) {
+    frNet* net = nullptr;
+    string_view vLine[5];
+    const char* pos = begin;
+    while (pos < end) {
+      const char* lineEnd = static_cast<const char*>(memchr(pos, '\n', end - pos));
+      if (lineEnd == nullptr) {
+        lineEnd = end;
       }
-      //cout <<endl;
+      // split the line in place
+      int cnt = 0;
+      const char* p = pos;
+      while (p < lineEnd) {
+        while (p < lineEnd && isGuideSpace(*p)) {
+          p++;
+        }
+        if (p == lineEnd) {
+          break;
+        }
+        const char* word = p;
+        while (p < lineEnd && !isGuideSpace(*p)) {
+          p++;
+        }
+        if (cnt < 5) {
+          vLine[cnt] = string_view(word, p - word);
+        }
+        cnt++;
+      }
+      pos = lineEnd + 1;
 
-      if (vLine.size() == 0) {
-        cout <<"Error: reading guide file!" <<endl;
-        exit(2);
-      } else if (vLine.size() == 1) {
-        netName = vLine[0];
-        if (design->topBlock->name2net.find(vLine[0]) == design->topBlock->name2net.end()) {
+      if (cnt == 0 || (cnt == 1 && (vLine[0] == "(" || vLine[0] == ")"))) {
+        continue;
+      } else if (cnt == 1) {
+        net = lookup.block->getNet(vLine[0]);
+        if (net == nullptr) {
           cout <<"Error: cannot find net: " <<vLine[0] <<endl;
           exit(2);
         }
-        net = design->topBlock->name2net[netName]; 
-      } else if (vLine.size() == 5) {
-        if (tech->name2layer.find(vLine[4]) == tech->name2layer.end()) {
+        shard.push_back(make_pair(net, vector<frRect>()));
+      } else if (cnt == 5 && net != nullptr) {
+        auto it = lookup.name2layer.find(string(vLine[4]));
+        if (it == lookup.name2layer.end()) {
           cout <<"Error: cannot find layer: " <<vLine[4] <<endl;
           exit(2);
         }
-        layerNum = tech->name2layer[vLine[4]]->getLayerNum();
+        frLayerNum layerNum = it->second;
 
         if (layerNum < BOTTOM_ROUTING_LAYER && layerNum != VIA_ACCESS_LAYERNUM
             || layerNum > TOP_ROUTING_LAYER) {
-          cout << "Error: guide in net " << netName
+          cout << "Error: guide in net " << net->getName()
                << " uses layer " << vLine[4]
                << " (" << layerNum << ")"
                << " that is outside the allowed routing range "
@@ -4972,31 +5091,133 @@ void io::Parser::readGuide() {
           exit(2);
         }
 
-        box.set(stoi(vLine[0]), stoi(vLine[1]), stoi(vLine[2]), stoi(vLine[3]));
+        frCoord coords[4];
+        for (int i = 0; i < 4; i++) {
+          auto wordEnd = vLine[i].data() + vLine[i].size();
+          auto res = from_chars(vLine[i].data(), wordEnd, coords[i]);
+          if (res.ec != errc() || res.ptr != wordEnd) {
+            cout <<"Error: reading guide file!" <<endl;
+            exit(2);
+          }
+        }
         frRect rect;
-        rect.setBBox(box);
+        rect.setBBox(frBox(coords[0], coords[1], coords[2], coords[3]));
         rect.setLayerNum(layerNum);
-        tmpGuides[net].push_back(rect);
-        ++numGuides;
-        if (numGuides < 1000000) {
-          if (numGuides % 100000 == 0) {
-            cout <<"guideIn read " <<numGuides <<" guides" <<endl;
-          }
-        } else {
-          if (numGuides % 1000000 == 0) {
-            cout <<"guideIn read " <<numGuides <<" guides" <<endl;
+        shard.back().second.push_back(rect);
+      } else {
+        cout <<"Error: reading guide file!" <<endl;
+        exit(2);
+      }
+    }
+  }
+
+  // cuts whole net blocks into ranges and parses them in parallel
+  void readGuide_text(const char* begin, const char* end, const guideLookup &lookup,
+                      frTechObject* tech, vector<guideShard> &shards) {
+    int numRanges = min((size_t)MAX_THREADS * 4, (size_t)(end - begin) / (1 << 16) + 1);
+    vector<const char*> cuts(numRanges + 1, end);
+    for (int i = 0; i < numRanges; i++) {
+      cuts[i] = nextGuideNetEnd(begin + (end - begin) / numRanges * i, begin, end);
+    }
+    shards.clear();
+    shards.resize(numRanges);
+    omp_set_num_threads(MAX_THREADS);
+    #pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < numRanges; i++) {
+      readGuide_range(cuts[i], cuts[i + 1], lookup, tech, shards[i]);
+    }
+  }
+}
+
+void io::Parser::readGuide() {
+  ProfileTask profile("IO:readGuide");
+
+  if (VERBOSE > 0) {
+    cout <<endl <<"reading guide ..." <<endl;
+  }
+
+  int numGuides = 0;
+
+  guideLookup lookup;
+  lookup.block = design->topBlock.get();
+  for (auto &layer: tech->getLayers()) {
+    lookup.name2layer[layer->getName()] = layer->getLayerNum();
+  }
+
+  // shards come back in file order, so tmpGuides matches a serial read
+  vector<guideShard> shards;
+  auto addShards = [&]() {
+    for (auto &shard: shards) {
+      for (auto &netGuides: shard) {
+        if (netGuides.second.empty()) {
+          continue;
+        }
+        auto &guides = tmpGuides[netGuides.first];
+        guides.insert(guides.end(), netGuides.second.begin(), netGuides.second.end());
+        for (int i = 0; i < (int)netGuides.second.size(); i++) {
+          ++numGuides;
+          if (numGuides < 1000000) {
+            if (numGuides % 100000 == 0) {
+              cout <<"guideIn read " <<numGuides <<" guides" <<endl;
+            }
+          } else {
+            if (numGuides % 1000000 == 0) {
+              cout <<"guideIn read " <<numGuides <<" guides" <<endl;
+            }
           }
         }
-
-      } else {
+      }
+    }
+    shards.clear();
+  };
+
+  if (isGzipFile(GUIDE_FILE)) {
+    // inflate block by block, carrying the unfinished net block over
+    gzFile fin = gzOpenRead(GUIDE_FILE);
+    if (fin == nullptr) {
+      cout <<"Error: failed to open guide file" <<endl;
+      exit(2);
+    }
+    const int blockSize = 1 << 26;
+    string text;
+    bool isEOF = false;
+    while (!isEOF) {
+      size_t oldSize = text.size();
+      text.resize(oldSize + blockSize);
+      int cnt = gzread(fin, &text[oldSize], blockSize);
+      if (cnt < 0) {
         cout <<"Error: reading guide file!" <<endl;
         exit(2);
       }
+      text.resize(oldSize + cnt);
+      isEOF = (cnt == 0);
+      const char* begin = text.data();
+      const char* end = begin + text.size();
+      const char* cut = isEOF ? end : lastGuideNetEnd(begin, end);
+      readGuide_text(begin, cut, lookup, tech, shards);
+      addShards();
+      text.erase(0, cut - begin);
     }
-    fin.close();
+    gzclose(fin);
   } else {
-    cout <<"Error: failed to open guide file" <<endl;
-    exit(2);
+    int fd = open(GUIDE_FILE.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+      cout <<"Error: failed to open guide file" <<endl;
+      exit(2);
+    }
+    if (st.st_size > 0) {
+      void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED) {
+        cout <<"Error: failed to open guide file" <<endl;
+        exit(2);
+      }
+      const char* begin = static_cast<const char*>(addr);
+      readGuide_text(begin, begin + st.st_size, lookup, tech, shards);
+      addShards();
+      munmap(addr, st.st_size);
+    }
+    close(fd);
   }
 
 
@@ -5007,7 +5228,7 @@ void io::Parser::readGuide() {
 
 }
 
-void io::Writer::fillConnFigs_net(frNet* net, bool isTA) {
+void io::Writer::fillConnFigs_net(frNet* net, netConnFigs &figs, bool isTA) {
   //bool enableOutput = true;
   bool enableOutput = false;
   auto netName = net->getName();
@@ -5017,9 +5238,9 @@ void io::Writer::fillConnFigs_net(frNet* net, bool isTA) {
       for (auto &uConnFig: uGuide->getRoutes()) {
         auto connFig = uConnFig.get();
         if (connFig->typeId() == frcPathSeg) {
-          connFigs[netName].push_back(make_shared<frPathSeg>(*static_cast<frPathSeg*>(connFig)));
+          figs.pathSegs.push_back(*static_cast<frPathSeg*>(connFig));
         } else if (connFig->typeId() == frcVia) {
-          connFigs[netName].push_back(make_shared<frVia>(*static_cast<frVia*>(connFig)));
+          figs.vias.push_back(*static_cast<frVia*>(connFig));
         } else {
           cout <<"Error: io::Writer::filliConnFigs does not support this type" <<endl;
         }
@@ -5031,49 +5252,50 @@ void io::Writer::fillConnFigs_net(frNet* net, bool isTA) {
     }
     for (auto &shape: net->getShapes()) {
       if (shape->typeId() == frcPathSeg) {
-        auto pathSeg = *static_cast<frPathSeg*>(shape.get());
+        auto pathSeg = static_cast<frPathSeg*>(shape.get());
         frPoint start, end;
-        pathSeg.getPoints(start, end);
+        pathSeg->getPoints(start, end);
 
         if (enableOutput) {
-          frLayerNum currLayerNum = pathSeg.getLayerNum();
+          frLayerNum currLayerNum = pathSeg->getLayerNum();
           cout << "  connfig pathseg (" << start.x() / 2000.0<< ", " << start.y() / 2000.0 
                << ") - (" << end.x() / 2000.0 << ", " << end.y() / 2000.0 << ") " << currLayerNum  <<"\n"; 
         }
-        connFigs[netName].push_back(make_shared<frPathSeg>(pathSeg));
+        figs.pathSegs.push_back(*pathSeg);
       }
     }
     for (auto &via: net->getVias()) {
-      connFigs[netName].push_back(make_shared<frVia>(*via));
+      figs.vias.push_back(*via);
     }
     for (auto &shape: net->getPatchWires()) {
-      auto pwire = static_cast<frPatchWire*>(shape.get());
-      connFigs[netName].push_back(make_shared<frPatchWire>(*pwire));
+      figs.patchWires.push_back(*static_cast<frPatchWire*>(shape.get()));
     }
   }
 }
 
 void io::Writer::splitVia_helper(frLayerNum layerNum, int isH, frCoord trackLoc, frCoord x, frCoord y, 
-  vector< vector< map<frCoord, vector<shared_ptr<frPathSeg> > > > > &mergedPathSegs) {
+  vector< vector< map<frCoord, vector<frPathSeg> > > > &mergedPathSegs) {
   if (layerNum >= 0 && layerNum < (int)(getTech()->getLayers().size()) &&
       mergedPathSegs.at(layerNum).at(isH).find(trackLoc) != mergedPathSegs.at(layerNum).at(isH).end()) {
-    for (auto &pathSeg: mergedPathSegs.at(layerNum).at(isH).at(trackLoc)) {
+    auto &pathSegs = mergedPathSegs.at(layerNum).at(isH).at(trackLoc);
+    for (auto &pathSeg: pathSegs) {
       frPoint begin, end;
-      pathSeg->getPoints(begin, end);
+      pathSeg.getPoints(begin, end);
       if ((isH == 0 && (begin.x() < x) && (end.x() > x)) ||
           (isH == 1 && (begin.y() < y) && (end.y() > y))) {
         frSegStyle style1, style2, style_default;
-        pathSeg->getStyle(style1);
-        pathSeg->getStyle(style2);
+        pathSeg.getStyle(style1);
+        pathSeg.getStyle(style2);
         style_default = getTech()->getLayer(layerNum)->getDefaultSegStyle();
-        shared_ptr<frPathSeg> newPathSeg = make_shared<frPathSeg>(*pathSeg);
-        pathSeg->setPoints(begin, frPoint(x,y));
+        frPathSeg newPathSeg(pathSeg);
+        pathSeg.setPoints(begin, frPoint(x,y));
         style1.setEndStyle(style_default.getEndStyle(), style_default.getEndExt());
-        pathSeg->setStyle(style1);
-        newPathSeg->setPoints(frPoint(x,y), end);
+        pathSeg.setStyle(style1);
+        newPathSeg.setPoints(frPoint(x,y), end);
         style2.setBeginStyle(style_default.getBeginStyle(), style_default.getBeginExt());
-        newPathSeg->setStyle(style2);
-        mergedPathSegs.at(layerNum).at(isH).at(trackLoc).push_back(newPathSeg);
+        newPathSeg.setStyle(style2);
+        // pathSeg is invalidated by the push_back, leave right away
+        pathSegs.push_back(newPathSeg);
         // via can only intersect at most one merged pathseg on one track
         break;
       }
@@ -5082,48 +5304,45 @@ void io::Writer::splitVia_helper(frLayerNum layerNum, int isH, frCoord trackLoc,
 }
 
 // merge pathseg, delete redundant via
-void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
+void io::Writer::mergeSplitConnFigs(netConnFigs &figs) {
   //if (VERBOSE > 0) {
   //  cout <<endl <<"merge and split ..." <<endl;
   //}
   // initialzie pathseg and via map
   map < tuple<frLayerNum, bool, frCoord>,
-        map<frCoord, vector< tuple<shared_ptr<frPathSeg>, bool> > 
+        map<frCoord, vector< tuple<frPathSeg*, bool> > 
            >
       > pathSegMergeMap;
-  map < tuple<frCoord, frCoord, frLayerNum>, shared_ptr<frVia> > viaMergeMap;
-  for (auto &connFig: connFigs) {
-    if (connFig->typeId() == frcPathSeg) {
-      auto pathSeg = dynamic_pointer_cast<frPathSeg>(connFig);
-      frPoint begin, end;
-      pathSeg->getPoints(begin, end);
-      frLayerNum layerNum = pathSeg->getLayerNum();
-      if (begin == end) {
-        // std::cout << "Warning: 0 length connfig\n";
-        continue; // if segment length = 0, ignore
-      } else {
-        // std::cout << "xxx\n";
-        bool isH = (begin.x() == end.x()) ? false : true;
-        frCoord trackLoc   = isH ? begin.y() : begin.x();
-        frCoord beginCoord = isH ? begin.x() : begin.y();
-        frCoord endCoord   = isH ? end.x()   : end.y();
-        pathSegMergeMap[make_tuple(layerNum, isH, trackLoc)][beginCoord].push_back(make_tuple(pathSeg, true));
-        pathSegMergeMap[make_tuple(layerNum, isH, trackLoc)][endCoord].push_back(make_tuple(pathSeg, false));
-      }
-    } else if (connFig->typeId() == frcVia) {
-      auto via = dynamic_pointer_cast<frVia>(connFig);
-      auto cutLayerNum = via->getViaDef()->getCutLayerNum();
-      frPoint viaPoint;
-      via->getOrigin(viaPoint);
-      viaMergeMap[make_tuple(viaPoint.x(), viaPoint.y(), cutLayerNum)] = via;
-      //cout <<"found via" <<endl;
+  map < tuple<frCoord, frCoord, frLayerNum>, frVia* > viaMergeMap;
+  for (auto &pathSeg: figs.pathSegs) {
+    frPoint begin, end;
+    pathSeg.getPoints(begin, end);
+    frLayerNum layerNum = pathSeg.getLayerNum();
+    if (begin == end) {
+      // std::cout << "Warning: 0 length connfig\n";
+      continue; // if segment length = 0, ignore
+    } else {
+      // std::cout << "xxx\n";
+      bool isH = (begin.x() == end.x()) ? false : true;
+      frCoord trackLoc   = isH ? begin.y() : begin.x();
+      frCoord beginCoord = isH ? begin.x() : begin.y();
+      frCoord endCoord   = isH ? end.x()   : end.y();
+      pathSegMergeMap[make_tuple(layerNum, isH, trackLoc)][beginCoord].push_back(make_tuple(&pathSeg, true));
+      pathSegMergeMap[make_tuple(layerNum, isH, trackLoc)][endCoord].push_back(make_tuple(&pathSeg, false));
     }
   }
+  for (auto &via: figs.vias) {
+    auto cutLayerNum = via.getViaDef()->getCutLayerNum();
+    frPoint viaPoint;
+    via.getOrigin(viaPoint);
+    viaMergeMap[make_tuple(viaPoint.x(), viaPoint.y(), cutLayerNum)] = &via;
+    //cout <<"found via" <<endl;
+  }
 
   // merge pathSeg
-  map<frCoord, vector<shared_ptr<frPathSeg> > > tmp1;
-  vector< map<frCoord, vector<shared_ptr<frPathSeg> > > > tmp2(2, tmp1);
-  vector< vector< map<frCoord, vector<shared_ptr<frPathSeg> > > > > mergedPathSegs(getTech()->getLayers().size(), tmp2);
+  map<frCoord, vector<frPathSeg> > tmp1;
+  vector< map<frCoord, vector<frPathSeg> > > tmp2(2, tmp1);
+  vector< vector< map<frCoord, vector<frPathSeg> > > > mergedPathSegs(getTech()->getLayers().size(), tmp2);
 
   for (auto &it1: pathSegMergeMap) {
     auto layerNum = get<0>(it1.first);
@@ -5131,7 +5350,7 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
     auto trackLoc = get<2>(it1.first);
     bool hasSeg = false;
     int cnt = 0;
-    shared_ptr<frPathSeg> newPathSeg;
+    frPathSeg newPathSeg;
     frSegStyle style;
     frPoint begin, end;
     for (auto &it2: it1.second) {
@@ -5143,7 +5362,7 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
       if (!hasSeg && cnt > 0) {
         style.setBeginStyle(frcTruncateEndStyle, 0);
         style.setEndStyle(frcTruncateEndStyle, 0);
-        newPathSeg = make_shared<frPathSeg>(*(get<0>(*(it2.second.begin()))));
+        newPathSeg = *(get<0>(*(it2.second.begin())));
         for (auto &pathSegTuple: it2.second) {
           auto pathSeg = get<0>(pathSegTuple);
           auto isBegin = get<1>(pathSegTuple);
@@ -5156,11 +5375,11 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
             }
           }
         }
-        newPathSeg->setStyle(style);
+        newPathSeg.setStyle(style);
         hasSeg = true;
       // newPathSeg end
       } else if (hasSeg && cnt == 0) {
-        newPathSeg->getPoints(begin, end);
+        newPathSeg.getPoints(begin, end);
         for (auto &pathSegTuple: it2.second) {
           auto pathSeg = get<0>(pathSegTuple);
           auto isBegin = get<1>(pathSegTuple);
@@ -5174,8 +5393,8 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
             }
           }
         }
-        newPathSeg->setPoints(begin, end);
-        newPathSeg->setStyle(style);
+        newPathSeg.setPoints(begin, end);
+        newPathSeg.setStyle(style);
         hasSeg = false;
         (mergedPathSegs.at(layerNum).at(isH))[trackLoc].push_back(newPathSeg);
       }
@@ -5183,8 +5402,8 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
   }
 
   // split pathseg from via
-  // mergedPathSegs[layerNum][isHorizontal] is a map<frCoord, vector<shared_ptr<frPathSeg> > >
-  //map < tuple<frCoord, frCoord, frLayerNum>, shared_ptr<frVia> > viaMergeMap;
+  // mergedPathSegs[layerNum][isHorizontal] is a map<frCoord, vector<frPathSeg> >
+  //map < tuple<frCoord, frCoord, frLayerNum>, frVia* > viaMergeMap;
   for (auto &it1: viaMergeMap) {
     auto x           = get<0>(it1.first);
     auto y           = get<1>(it1.first);
@@ -5223,56 +5442,57 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
           bool skip = false;
           // seg2 is horizontal
           frPoint seg1Begin, seg1End;
-          seg1->getPoints(seg1Begin, seg1End);
+          seg1.getPoints(seg1Begin, seg1End);
           for (auto &seg2: mapIt2.second) {
             frPoint seg2Begin, seg2End;
-            seg2->getPoints(seg2Begin, seg2End);
+            seg2.getPoints(seg2Begin, seg2End);
             bool pushNewSeg1 = false;
             bool pushNewSeg2 = false;
-            shared_ptr<frPathSeg> newSeg1;
-            shared_ptr<frPathSeg> newSeg2;
+            frPathSeg newSeg1;
+            frPathSeg newSeg2;
             // check whether seg1 needs to be split, break seg1
             if (seg2Begin.y() > seg1Begin.y() && seg2Begin.y() < seg1End.y()) {
               pushNewSeg1 = true;
-              newSeg1 = make_shared<frPathSeg>(*seg1);
+              newSeg1 = seg1;
               // modify seg1
-              seg1->setPoints(seg1Begin, frPoint(seg1End.x(), seg2End.y()));
+              seg1.setPoints(seg1Begin, frPoint(seg1End.x(), seg2End.y()));
               // modify newSeg1
-              newSeg1->setPoints(frPoint(seg1End.x(), seg2Begin.y()), seg1End);
+              newSeg1.setPoints(frPoint(seg1End.x(), seg2Begin.y()), seg1End);
               // modify endstyle
-              auto layerNum = seg1->getLayerNum();
+              auto layerNum = seg1.getLayerNum();
               frSegStyle tmpStyle1;
               frSegStyle tmpStyle2;
               frSegStyle style_default;
-              seg1->getStyle(tmpStyle1);
-              seg1->getStyle(tmpStyle2);
+              seg1.getStyle(tmpStyle1);
+              seg1.getStyle(tmpStyle2);
               style_default = getTech()->getLayer(layerNum)->getDefaultSegStyle();
               tmpStyle1.setEndStyle(frcExtendEndStyle, style_default.getEndExt());
-              seg1->setStyle(tmpStyle1);
+              seg1.setStyle(tmpStyle1);
               tmpStyle2.setBeginStyle(frcExtendEndStyle, style_default.getBeginExt());
-              newSeg1->setStyle(tmpStyle2);
+              newSeg1.setStyle(tmpStyle2);
             }
             // check whether seg2 needs to be split, break seg2
             if (seg1Begin.x() > seg2Begin.x() && seg1Begin.x() < seg2End.x()) {
               pushNewSeg2 = true;
-              newSeg2 = make_shared<frPathSeg>(*seg1);
+              newSeg2 = seg1;
               // modify seg2
-              seg2->setPoints(seg2Begin, frPoint(seg1End.x(), seg2End.y()));
+              seg2.setPoints(seg2Begin, frPoint(seg1End.x(), seg2End.y()));
               // modify newSeg2
-              newSeg2->setPoints(frPoint(seg1End.x(), seg2Begin.y()), seg2End);
+              newSeg2.setPoints(frPoint(seg1End.x(), seg2Begin.y()), seg2End);
               // modify endstyle
-              auto layerNum = seg2->getLayerNum();
+              auto layerNum = seg2.getLayerNum();
               frSegStyle tmpStyle1;
               frSegStyle tmpStyle2;
               frSegStyle style_default;
-              seg2->getStyle(tmpStyle1);
-              seg2->getStyle(tmpStyle2);
+              seg2.getStyle(tmpStyle1);
+              seg2.getStyle(tmpStyle2);
               style_default = getTech()->getLayer(layerNum)->getDefaultSegStyle();
               tmpStyle1.setEndStyle(frcExtendEndStyle, style_default.getEndExt());
-              seg2->setStyle(tmpStyle1);
+              seg2.setStyle(tmpStyle1);
               tmpStyle2.setBeginStyle(frcExtendEndStyle, style_default.getBeginExt());
-              newSeg2->setStyle(tmpStyle2);
+              newSeg2.setStyle(tmpStyle2);
             }
+            // seg1 / seg2 are invalidated by the push_back, leave right away
             if (pushNewSeg1) {
               mapIt1.second.push_back(newSeg1);
             }
@@ -5291,25 +5511,25 @@ void io::Writer::mergeSplitConnFigs(list<shared_ptr<frConnFig> > &connFigs) {
     }
   }
 
-
   // write back pathseg
-  connFigs.clear();
+  vector<frPathSeg> pathSegs;
   for (auto &it1: mergedPathSegs) {
     for (auto &it2: it1) {
       for (auto &it3: it2) {
         for (auto &it4: it3.second) {
-          connFigs.push_back(it4);
+          pathSegs.push_back(it4);
         }
       }
     }
   }
+  figs.pathSegs.swap(pathSegs);
 
   // write back via
-  //map < tuple<frCoord, frCoord, frLayerNum>, shared_ptr<frVia> > viaMergeMap;
+  vector<frVia> vias;
   for (auto &it: viaMergeMap) {
-    connFigs.push_back(it.second);
+    vias.push_back(*it.second);
   }
-
+  figs.vias.swap(vias);
 }
 
 void io::Writer::fillViaDefs() {
@@ -5323,17 +5543,27 @@ void io::Writer::fillViaDefs() {
 }
 
 void io::Writer::fillConnFigs(bool isTA) {
-  connFigs.clear();
   if (VERBOSE > 0) {
     cout <<endl <<"post processing ..." <<endl;
   }
-  for (auto &net: getDesign()->getTopBlock()->getNets()) {
-    fillConnFigs_net(net.get(), isTA);
-  }
-  if (isTA) {
-    for (auto &it: connFigs) {
-      mergeSplitConnFigs(it.second);
-    }
+  auto &nets = getDesign()->getTopBlock()->getNets();
+  connFigs.clear();
+  connFigs.resize(nets.size());
+  net2ConnFigs.clear();
+  for (int i = 0; i < (int)nets.size(); i++) {
+    net2ConnFigs[nets[i]->getName()] = i;
+  }
+  // nets are independent: collect, merge and format each one on its own,
+  // writeDef then splices the text back in def order
+  omp_set_num_threads(MAX_THREADS);
+  #pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int)nets.size(); i++) {
+    auto &figs = connFigs[i];
+    fillConnFigs_net(nets[i].get(), figs, isTA);
+    if (isTA) {
+      mergeSplitConnFigs(figs);
+    }
+    fillConnFigs_text(figs);
   }
 }
 
@@ -29,6 +29,7 @@
 #ifndef _FR_IO_H_
 #define _FR_IO_H_
 
+#include <cstdint>
 #include <memory>
 #include <list>
 #include <boost/icl/interval_set.hpp>
@@ -44,12 +45,22 @@ namespace fr {
       // constructors
       Parser(frDesign* designIn): design(designIn), tech(design->getTech()), tmpBlock(nullptr), readLayerCnt(0),
                                   tmpGuides(), tmpGRPins(), trackOffsetMap(), prefTrackPatterns(), numRefBlocks(0),
-                                  numInsts(0), numTerms(0), numNets(0), numBlockages(0) {}
+                                  numInsts(0), numTerms(0), numNets(0), numBlockages(0), numLefVias(0) {}
       // others
       void readLefDef();
       void readGuide();
+      // binary snapshot of the LEF/DEF/guide read results
+      bool readSnapshot(const std::string &fileName);
+      void writeSnapshot(const std::string &fileName);
       void postProcess();
       void postProcessGuide();
+      // regenerates the guides of the nets in tmpGuides only, the rest of the
+      // design keeps its guides and gr pins
+      void postProcessGuide_eco();
+      // raw guides by net, readGuide fills them, a design built in memory sets them
+      std::map<frNet*, std::vector<frRect>, frBlockObjectComp> &getGuides() {
+        return tmpGuides;
+      }
       std::map<frBlock*, std::map<frOrient, std::map<std::vector<frCoord>, std::set<frInst*, frBlockObjectComp> > >, frBlockObjectComp> &getTrackOffsetMap() {
         return trackOffsetMap;
       }
@@ -78,6 +89,7 @@ namespace fr {
       int numTerms;     // including instterm and term
       int numNets;      // including snet and net
       int numBlockages; // including instBlockage and blockage
+      int numLefVias;   // tech->vias before DEF VIAS are appended
 
       // LEF/DEF parser helper
       class Callbacks;
@@ -126,7 +138,7 @@ namespace fr {
       void instAnalysis();
 
       // postProcessGuide functions
-      void genGuides(frNet* net, std::vector<frRect> &rects);
+      void genGuides(frNet* net, std::vector<frRect> &rects, std::vector<std::pair<frBlockObject*, frPoint> > &grPins);
       void genGuides_addCoverGuide(frNet* net, std::vector<frRect> &rects);
       void genGuides_merge(std::vector<frRect> &rects, std::vector<std::map<frCoord, boost::icl::interval_set<frCoord> > > &intvs);
       void genGuides_split(std::vector<frRect> &rects, std::vector<std::map<frCoord, boost::icl::interval_set<frCoord> > > &intvs,
@@ -151,13 +163,17 @@ namespace fr {
                            std::vector<bool> &adjVisited, std::vector<int> &adjPrevIdx, 
                            std::map<std::pair<frPoint, frLayerNum>, std::set<int> > &nodeMap, int &gCnt, int &nCnt, bool forceFeedThrough, bool retry);
       void genGuides_final(frNet *net, std::vector<frRect> &rects, std::vector<bool> &adjVisited, std::vector<int> &adjPrevIdx, int gCnt, int nCnt,
-                           std::map<frBlockObject*, std::set<std::pair<frPoint, frLayerNum> >, frBlockObjectComp> &pin2GCellMap);
+                           std::map<frBlockObject*, std::set<std::pair<frPoint, frLayerNum> >, frBlockObjectComp> &pin2GCellMap,
+                           std::vector<std::pair<frBlockObject*, frPoint> > &grPins);
 
       // write guide
       void writeGuideFile();
 
       // misc
       void addFakeNets();
+
+      // snapshot helpers
+      std::uint64_t snapshot_getKey();
     };
     class Writer {
     public:
@@ -173,7 +189,15 @@ namespace fr {
       // others
       void writeFromTA();
       void writeFromDR(const std::string &str = "");
-      std::map< frString, std::list<std::shared_ptr<frConnFig> > > connFigs; // all connFigs ready to def
+      // routed shapes of one net, kept by value in def output order
+      struct netConnFigs {
+        std::vector<frPathSeg>   pathSegs;
+        std::vector<frVia>       vias;
+        std::vector<frPatchWire> patchWires;
+        std::string              text; // "+ ROUTED" / "NEW" lines ready to def
+      };
+      std::vector<netConnFigs> connFigs; // all connFigs ready to def, indexed as top block nets
+      std::map<frString, int>  net2ConnFigs;
       std::vector<frViaDef*> viaDefs;
     protected:
       frTechObject*                                  tech;
@@ -181,11 +205,14 @@ namespace fr {
       
       void fillViaDefs();
       void fillConnFigs(bool isTA);
-      void fillConnFigs_net(frNet* net, bool isTA);
-      void mergeSplitConnFigs(std::list<std::shared_ptr<frConnFig> > &connFigs);
+      void fillConnFigs_net(frNet* net, netConnFigs &figs, bool isTA);
+      void fillConnFigs_text(netConnFigs &figs);
+      void mergeSplitConnFigs(netConnFigs &figs);
       void splitVia_helper(frLayerNum layerNum, int isH, frCoord trackLoc, frCoord x, frCoord y, 
-                           std::vector< std::vector< std::map<frCoord, std::vector<std::shared_ptr<frPathSeg> > > > > &mergedPathSegs);
+                           std::vector< std::vector< std::map<frCoord, std::vector<frPathSeg> > > > &mergedPathSegs);
       int writeDef(bool isTA, const std::string &str = "");
+      void writeDef_net(std::string &buf, const std::string &stmt);
+      void writeDef_connFig(std::string &buf, frConnFig* connFig);
     };
   }
 }
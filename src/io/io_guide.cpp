@@ -573,7 +573,7 @@ void io::Parser::genGuides_addCoverGuide(frNet *net, vector<frRect> &rects) {
   } 
 }
 
-void io::Parser::genGuides(frNet *net, vector<frRect> &rects) {
+void io::Parser::genGuides(frNet *net, vector<frRect> &rects, vector<pair<frBlockObject*, frPoint> > &grPins) {
   //bool enableOutput = true;
   bool enableOutput = false;
   // cout <<"net " <<net->getName() <<endl <<flush;
@@ -662,13 +662,13 @@ void io::Parser::genGuides(frNet *net, vector<frRect> &rects) {
     vector<int>  adjPrevIdx;
     if (genGuides_astar(net, adjVisited, adjPrevIdx, nodeMap, gCnt, nCnt, false, retry)) {
       //cout <<"astar done" <<endl <<flush;
-      genGuides_final(net, rects, adjVisited, adjPrevIdx, gCnt, nCnt, pin2GCellMap);
+      genGuides_final(net, rects, adjVisited, adjPrevIdx, gCnt, nCnt, pin2GCellMap, grPins);
       break;
     } else {
       if (retry) {
         if (!ALLOW_PIN_AS_FEEDTHROUGH) {
           if (genGuides_astar(net, adjVisited, adjPrevIdx, nodeMap, gCnt, nCnt, true, retry)) {
-            genGuides_final(net, rects, adjVisited, adjPrevIdx, gCnt, nCnt, pin2GCellMap);
+            genGuides_final(net, rects, adjVisited, adjPrevIdx, gCnt, nCnt, pin2GCellMap, grPins);
             break;
           } else {
             cout <<"Error: critical error guide not connected, exit now 1!" <<endl;
@@ -686,7 +686,8 @@ void io::Parser::genGuides(frNet *net, vector<frRect> &rects) {
 }
 
 void io::Parser::genGuides_final(frNet *net, vector<frRect> &rects, vector<bool> &adjVisited, vector<int> &adjPrevIdx, int gCnt, int nCnt,
-                                 map<frBlockObject*, set<pair<frPoint, frLayerNum> >, frBlockObjectComp> &pin2GCellMap) {
+                                 map<frBlockObject*, set<pair<frPoint, frLayerNum> >, frBlockObjectComp> &pin2GCellMap,
+                                 vector<pair<frBlockObject*, frPoint> > &grPins) {
   //bool enableOutput = true;
   bool enableOutput = false;
   vector<frBlockObject*> pin2ptr;
@@ -749,7 +750,7 @@ void io::Parser::genGuides_final(frNet *net, vector<frRect> &rects, vector<bool>
     for (auto &[pt, lNum]: pinIdx2GCellUpdated[i]) {
       frPoint absPt;
       design->getTopBlock()->getGCellCenter(pt, absPt);
-      tmpGRPins.push_back(make_pair(obj, absPt));
+      grPins.push_back(make_pair(obj, absPt));
       updatedNodeMap[make_pair(pt, lNum)].insert(i + gCnt);
       if (enableOutput) {
         cout <<"pin   final " <<i + gCnt <<" " <<pt <<" " <<design->getTech()->getLayer(lNum)->getName() <<endl;
@@ -0,0 +1,96 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include "io/io_gzip.h"
+
+using namespace std;
+using namespace fr;
+
+namespace {
+  const unsigned gzBufferSize = 1 << 20;
+
+  // first bytes of the file, fewer if the file is shorter
+  int readMagic(const string &fileName, unsigned char magic[4]) {
+    FILE* f = fopen(fileName.c_str(), "rb");
+    if (f == nullptr) {
+      return 0;
+    }
+    int cnt = fread(magic, 1, 4, f);
+    fclose(f);
+    return cnt;
+  }
+
+  bool isZstdMagic(const unsigned char magic[4], int cnt) {
+    return cnt == 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd;
+  }
+}
+
+bool io::isGzipFile(const string &fileName) {
+  unsigned char magic[4];
+  int cnt = readMagic(fileName, magic);
+  if (isZstdMagic(magic, cnt)) {
+    cout <<"Error: " <<fileName <<" is zstd compressed, only gzip is supported" <<endl;
+    exit(1);
+  }
+  return cnt >= 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+}
+
+gzFile io::gzOpenRead(const string &fileName) {
+  // rejects zstd before zlib passes it through as text
+  isGzipFile(fileName);
+  gzFile file = gzopen(fileName.c_str(), "rb");
+  if (file != nullptr) {
+    gzbuffer(file, gzBufferSize);
+  }
+  return file;
+}
+
+gzFile io::gzOpenWrite(const string &fileName) {
+  bool isGz = fileName.size() > 3 && fileName.compare(fileName.size() - 3, 3, ".gz") == 0;
+  // "T" writes without compression through the same interface
+  gzFile file = gzopen(fileName.c_str(), isGz ? "wb6" : "wT");
+  if (file != nullptr) {
+    gzbuffer(file, gzBufferSize);
+  }
+  return file;
+}
+
+bool io::gzGetLine(gzFile file, string &line) {
+  char buf[4096];
+  line.clear();
+  while (gzgets(file, buf, sizeof(buf)) != nullptr) {
+    line += buf;
+    if (line.back() == '\n') {
+      break;
+    }
+  }
+  return !line.empty();
+}
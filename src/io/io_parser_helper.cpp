@@ -27,10 +27,12 @@
  */
 
 #include <chrono>
+#include <omp.h>
 #include <iostream>
 #include <boost/graph/connected_components.hpp>
 #include "global.h"
 #include "io/io.h"
+#include "io/io_gzip.h"
 #include "frBaseTypes.h"
 #include "frProfileTask.h"
 #include <fstream>
@@ -551,9 +553,9 @@ void io::Parser::writeRefDef() {
   if (REF_OUT_FILE != DEF_FILE) {
     cout << "Writing reference output def...\n";
     bool hasVia = false;
-    ifstream fin(DEF_FILE);
+    gzFile fin = gzOpenRead(DEF_FILE);
     ofstream fout(REF_OUT_FILE);
-    if (!fin.is_open()) {
+    if (fin == nullptr) {
       cout << "Error: cannot open input DEF\n";
       exit(1);
     }
@@ -564,7 +566,10 @@ void io::Parser::writeRefDef() {
     string line;
     string a;
     int b;
-    while (getline(fin, line)) {
+    while (gzGetLine(fin, line)) {
+      if (line.back() == '\n') {
+        line.pop_back();
+      }
       istringstream iss(line);
       if (!(iss >> a >> b)) {
         continue;
@@ -576,10 +581,12 @@ void io::Parser::writeRefDef() {
     }
 
     // reset and write ref
-    fin.clear();
-    fin.seekg(0, ios::beg);
+    gzrewind(fin);
 
-    while (getline(fin, line)) {
+    while (gzGetLine(fin, line)) {
+      if (line.back() == '\n') {
+        line.pop_back();
+      }
       bool skip = false;
       istringstream iss(line);
       if (iss >> a >> b) {
@@ -641,7 +648,7 @@ void io::Parser::writeRefDef() {
       }
     }
 
-    fin.close();
+    gzclose(fin);
     fout.close();
   }
 }
@@ -671,6 +678,46 @@ void io::Parser::postProcess() {
   design->getRegionQuery()->initDRObj(design->getTech()->getLayers().size()); // second init from FlexDR.cpp
 }
 
+void io::Parser::postProcessGuide_eco() {
+  ProfileTask profile("IO:postProcessGuide_eco");
+  auto rq = design->getRegionQuery();
+  set<frNet*, frBlockObjectComp> nets;
+  for (auto &[net, rects]: tmpGuides) {
+    nets.insert(net);
+  }
+  rq->removeOrigGuides(nets);
+  rq->removeGRPins(nets);
+  for (auto &[net, rects]: tmpGuides) {
+    for (auto &rect: rects) {
+      rq->addOrigGuide(net, rect);
+    }
+    for (auto &guide: net->getGuides()) {
+      rq->removeGuide(guide.get());
+    }
+    net->clearGuides();
+    genGuides(net, rects, tmpGRPins);
+    for (auto &guide: net->getGuides()) {
+      rq->addGuide(guide.get());
+    }
+  }
+  for (auto &[obj, pt]: tmpGRPins) {
+    rq->addGRPin(obj, pt);
+  }
+  tmpGRPins.clear();
+
+  // global unique id for guides
+  int currId = 0;
+  for (auto &net: design->getTopBlock()->getNets()) {
+    for (auto &guide: net->getGuides()) {
+      guide->setId(currId);
+      currId++;
+    }
+  }
+  if (VERBOSE > 0) {
+    cout <<endl <<"regenerated guides of " <<nets.size() <<" nets" <<endl;
+  }
+}
+
 void io::Parser::postProcessGuide() {
   ProfileTask profile("IO:postProcessGuide");
   if (VERBOSE > 0) {
@@ -685,8 +732,20 @@ void io::Parser::postProcessGuide() {
   //    cout <<"Error: postProcessGuide cannot find net" <<endl;
   //    exit(1);
   //  }
+  // nets only share tmpGRPins: each net fills its own list and the lists
+  // are appended in tmpGuides order, same as a serial run
+  vector<pair<frNet*, vector<frRect>*> > netRects;
   for (auto &[net, rects]:tmpGuides) {
-    genGuides(net, rects);
+    netRects.push_back(make_pair(net, &rects));
+  }
+  vector<vector<pair<frBlockObject*, frPoint> > > netGRPins(netRects.size());
+  omp_set_num_threads(MAX_THREADS);
+  #pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int)netRects.size(); i++) {
+    genGuides(netRects[i].first, *netRects[i].second, netGRPins[i]);
+  }
+  for (auto &grPins: netGRPins) {
+    tmpGRPins.insert(tmpGRPins.end(), grPins.begin(), grPins.end());
     cnt++;
     if (VERBOSE > 0) {
       if (cnt < 100000) {
@@ -0,0 +1,857 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "frProfileTask.h"
+#include "global.h"
+#include "io/io.h"
+#include "db/infra/frHash.h"
+
+using namespace std;
+using namespace fr;
+
+// The snapshot holds everything readDef and readGuide add to the design, so
+// a rerun on unchanged inputs only has to parse the (small) LEF. All records
+// are fixed-size PODs referring to each other by index, which lets the loader
+// use the mmapped file in place without any decoding pass.
+namespace {
+  // bump whenever a record layout or the meaning of a field changes
+  const uint32_t snapshotVersion = 2;
+  const char snapshotMagic[4] = {'F', 'R', 'S', 'N'};
+
+  enum snapSectionEnum {
+    STRINGS = 0,
+    POINTS,
+    BOUNDARIES,
+    TRACKS,
+    FIGS,
+    PINS,
+    VIADEFS,
+    TERMS,
+    INSTS,
+    NETS,
+    CONNS,
+    PATHSEGS,
+    VIAS,
+    BLOCKAGES,
+    NUM_SECTIONS
+  };
+
+  struct snapSection {
+    uint64_t offset;
+    uint64_t count;
+  };
+
+  struct snapHeader {
+    char        magic[4];
+    uint32_t    version;
+    uint64_t    key;
+    int32_t     numRefBlocks;
+    int32_t     numInsts;
+    int32_t     numTerms;
+    int32_t     numNets;
+    int32_t     numBlockages;
+    int32_t     numLefVias;
+    int32_t     numLayers;
+    uint32_t    dbu;
+    uint32_t    designName;
+    snapSection sections[NUM_SECTIONS];
+  };
+
+  struct snapRange {
+    uint32_t begin;
+    uint32_t count;
+  };
+
+  struct snapPoint {
+    int32_t x;
+    int32_t y;
+  };
+
+  struct snapBoundary {
+    snapRange points;
+  };
+
+  struct snapTrack {
+    int32_t  layerNum;
+    int32_t  isHorizontal;
+    int32_t  startCoord;
+    uint32_t numTracks;
+    uint32_t trackSpacing;
+  };
+
+  // rect, or polygon when points is non-empty; slot is 0/1/2 for via def
+  // layer1/cut/layer2 figs and unused otherwise
+  struct snapFig {
+    int32_t   layerNum;
+    int32_t   slot;
+    int32_t   xl;
+    int32_t   yl;
+    int32_t   xh;
+    int32_t   yh;
+    snapRange points;
+  };
+
+  struct snapPin {
+    snapRange figs;
+  };
+
+  struct snapViaDef {
+    uint32_t  name;
+    snapRange figs;
+  };
+
+  struct snapTerm {
+    uint32_t  name;
+    int32_t   id;
+    int32_t   type;
+    snapRange pins;
+  };
+
+  // instTerm and instBlockage ids are handed out consecutively per inst
+  struct snapInst {
+    uint32_t name;
+    uint32_t refBlockName;
+    int32_t  x;
+    int32_t  y;
+    int32_t  orient;
+    int32_t  id;
+    int32_t  instTermBaseId;
+    int32_t  instBlkBaseId;
+    int32_t  numInstTerms;
+  };
+
+  struct snapNet {
+    uint32_t  name;
+    int32_t   id;
+    int32_t   type;
+    int32_t   isSNet;
+    snapRange conns;
+    snapRange pathSegs;
+    snapRange vias;
+    snapRange guides;
+  };
+
+  // instIdx == -1 refers to a top-level term
+  struct snapConn {
+    int32_t instIdx;
+    int32_t termIdx;
+  };
+
+  struct snapPathSeg {
+    int32_t  layerNum;
+    int32_t  bx;
+    int32_t  by;
+    int32_t  ex;
+    int32_t  ey;
+    uint32_t width;
+    int32_t  beginStyle;
+    uint32_t beginExt;
+    int32_t  endStyle;
+    uint32_t endExt;
+  };
+
+  struct snapVia {
+    int32_t viaDefIdx;
+    int32_t x;
+    int32_t y;
+  };
+
+  struct snapBlockage {
+    int32_t   id;
+    snapRange figs;
+  };
+
+  const size_t snapRecordSize[NUM_SECTIONS] = {
+    sizeof(char),        sizeof(snapPoint),  sizeof(snapBoundary), sizeof(snapTrack),
+    sizeof(snapFig),     sizeof(snapPin),    sizeof(snapViaDef),   sizeof(snapTerm),
+    sizeof(snapInst),    sizeof(snapNet),    sizeof(snapConn),     sizeof(snapPathSeg),
+    sizeof(snapVia),     sizeof(snapBlockage)
+  };
+
+  class snapWriter {
+  public:
+    vector<char>         strings;
+    vector<snapPoint>    points;
+    vector<snapBoundary> boundaries;
+    vector<snapTrack>    tracks;
+    vector<snapFig>      figs;
+    vector<snapPin>      pins;
+    vector<snapViaDef>   viaDefs;
+    vector<snapTerm>     terms;
+    vector<snapInst>     insts;
+    vector<snapNet>      nets;
+    vector<snapConn>     conns;
+    vector<snapPathSeg>  pathSegs;
+    vector<snapVia>      vias;
+    vector<snapBlockage> blockages;
+
+    uint32_t addString(const string &str) {
+      auto it = stringOffsets.find(str);
+      if (it != stringOffsets.end()) {
+        return it->second;
+      }
+      uint32_t offset = strings.size();
+      strings.insert(strings.end(), str.begin(), str.end());
+      strings.push_back('\0');
+      stringOffsets[str] = offset;
+      return offset;
+    }
+    snapRange addPoints(const vector<frPoint> &pts) {
+      snapRange range = {(uint32_t)points.size(), (uint32_t)pts.size()};
+      for (auto &pt: pts) {
+        points.push_back({pt.x(), pt.y()});
+      }
+      return range;
+    }
+    void addFig(const frShape* shape, int slot) {
+      snapFig fig = {shape->getLayerNum(), slot, 0, 0, 0, 0, {0, 0}};
+      if (shape->typeId() == frcPolygon) {
+        fig.points = addPoints(static_cast<const frPolygon*>(shape)->getPoints());
+      } else {
+        frBox box;
+        shape->getBBox(box);
+        fig.xl = box.left();
+        fig.yl = box.bottom();
+        fig.xh = box.right();
+        fig.yh = box.top();
+      }
+      figs.push_back(fig);
+    }
+    template <typename T>
+    void getSection(const vector<T> &records, snapSection &section, vector<const char*> &data) {
+      section.count = records.size();
+      data.push_back(reinterpret_cast<const char*>(records.data()));
+    }
+  protected:
+    unordered_map<string, uint32_t> stringOffsets;
+  };
+
+  void fillFigs(snapWriter &writer, const frPin* pin, snapRange &range) {
+    range.begin = writer.figs.size();
+    for (auto &uFig: pin->getFigs()) {
+      writer.addFig(static_cast<const frShape*>(uFig.get()), 0);
+    }
+    range.count = writer.figs.size() - range.begin;
+  }
+
+  // begin and count of a record range lie inside a section of numRecords
+  bool isValidRange(const snapRange &range, uint64_t numRecords) {
+    return (uint64_t)range.begin + range.count <= numRecords;
+  }
+
+  frBox getFigBox(const snapFig &fig) {
+    return frBox(fig.xl, fig.yl, fig.xh, fig.yh);
+  }
+
+  vector<frPoint> getFigPoints(const snapFig &fig, const snapPoint* points) {
+    vector<frPoint> pts;
+    for (uint32_t i = 0; i < fig.points.count; i++) {
+      auto &pt = points[fig.points.begin + i];
+      pts.push_back(frPoint(pt.x, pt.y));
+    }
+    return pts;
+  }
+
+  unique_ptr<frPin> getPin(const snapRange &range, const snapFig* figs, const snapPoint* points) {
+    auto pinIn = make_unique<frPin>();
+    pinIn->setId(0);
+    for (uint32_t i = 0; i < range.count; i++) {
+      auto &fig = figs[range.begin + i];
+      unique_ptr<frPinFig> uptr;
+      if (fig.points.count) {
+        auto pinFig = make_unique<frPolygon>();
+        pinFig->setPoints(getFigPoints(fig, points));
+        pinFig->addToPin(pinIn.get());
+        pinFig->setLayerNum(fig.layerNum);
+        uptr = std::move(pinFig);
+      } else {
+        auto pinFig = make_unique<frRect>();
+        pinFig->setBBox(getFigBox(fig));
+        pinFig->addToPin(pinIn.get());
+        pinFig->setLayerNum(fig.layerNum);
+        uptr = std::move(pinFig);
+      }
+      pinIn->addPinFig(std::move(uptr));
+    }
+    return pinIn;
+  }
+}
+
+// size and mtime of every input; any edit invalidates the snapshot
+uint64_t io::Parser::snapshot_getKey() {
+  uint64_t hash = frHashSeed;
+  frHashBytes(hash, &snapshotVersion, sizeof(snapshotVersion));
+  for (auto &fileName: {LEF_FILE, DEF_FILE, GUIDE_FILE}) {
+    struct stat st;
+    if (stat(fileName.c_str(), &st) != 0) {
+      return 0;
+    }
+    int64_t fileInfo[3] = {(int64_t)st.st_size, (int64_t)st.st_mtim.tv_sec, (int64_t)st.st_mtim.tv_nsec};
+    frHashString(hash, fileName);
+    frHashBytes(hash, fileInfo, sizeof(fileInfo));
+  }
+  return hash;
+}
+
+void io::Parser::writeSnapshot(const string &fileName) {
+  ProfileTask profile("IO:writeSnapshot");
+  auto key = snapshot_getKey();
+  if (key == 0) {
+    cout <<"Warning: cannot stat design inputs, snapshot not written" <<endl;
+    return;
+  }
+  auto topBlock = design->getTopBlock();
+  // readDef only produces path segs and vias on nets; anything else would be
+  // dropped silently, so such a design is not snapshotted
+  for (auto nets: {&topBlock->getNets(), &topBlock->getSNets()}) {
+    for (auto &uNet: *nets) {
+      bool isLossy = !uNet->getPatchWires().empty();
+      for (auto &uShape: uNet->getShapes()) {
+        isLossy = isLossy || uShape->typeId() != frcPathSeg;
+      }
+      if (isLossy) {
+        cout <<"Warning: net " <<uNet->getName() <<" has shapes the snapshot cannot hold, snapshot not written" <<endl;
+        return;
+      }
+    }
+  }
+  snapWriter writer;
+
+  snapHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, snapshotMagic, 4);
+  header.version      = snapshotVersion;
+  header.key          = key;
+  header.numRefBlocks = numRefBlocks;
+  header.numInsts     = numInsts;
+  header.numTerms     = numTerms;
+  header.numNets      = numNets;
+  header.numBlockages = numBlockages;
+  header.numLefVias   = numLefVias;
+  header.numLayers    = tech->layers.size();
+  header.dbu          = topBlock->getDBUPerUU();
+  header.designName   = writer.addString(topBlock->getName());
+
+  for (auto &boundary: topBlock->getBoundaries()) {
+    writer.boundaries.push_back({writer.addPoints(boundary.getPoints())});
+  }
+  for (auto tp: topBlock->getTrackPatterns()) {
+    writer.tracks.push_back({tp->getLayerNum(), (int32_t)tp->isHorizontal(), tp->getStartCoord(),
+                             tp->getNumTracks(), tp->getTrackSpacing()});
+  }
+  for (int i = numLefVias; i < (int)tech->vias.size(); i++) {
+    auto viaDef = tech->vias[i].get();
+    snapViaDef rec = {writer.addString(viaDef->getName()), {(uint32_t)writer.figs.size(), 0}};
+    for (auto &uFig: viaDef->getLayer1Figs()) {
+      writer.addFig(uFig.get(), 0);
+    }
+    for (auto &uFig: viaDef->getCutFigs()) {
+      writer.addFig(uFig.get(), 1);
+    }
+    for (auto &uFig: viaDef->getLayer2Figs()) {
+      writer.addFig(uFig.get(), 2);
+    }
+    rec.figs.count = writer.figs.size() - rec.figs.begin;
+    writer.viaDefs.push_back(rec);
+  }
+
+  map<frTerm*, int> term2Idx;
+  for (auto &uTerm: topBlock->getTerms()) {
+    snapTerm rec = {writer.addString(uTerm->getName()), uTerm->getId(), (int32_t)uTerm->getType(), {0, 0}};
+    rec.pins.begin = writer.pins.size();
+    for (auto &uPin: uTerm->getPins()) {
+      snapPin pinRec;
+      fillFigs(writer, uPin.get(), pinRec.figs);
+      writer.pins.push_back(pinRec);
+    }
+    rec.pins.count = writer.pins.size() - rec.pins.begin;
+    term2Idx[uTerm.get()] = writer.terms.size();
+    writer.terms.push_back(rec);
+  }
+
+  map<frInst*, int> inst2Idx;
+  for (auto &uInst: topBlock->getInsts()) {
+    auto inst = uInst.get();
+    frPoint origin;
+    inst->getOrigin(origin);
+    snapInst rec = {writer.addString(inst->getName()), writer.addString(inst->getRefBlock()->getName()),
+                    origin.x(), origin.y(), (int32_t)frOrientEnum(inst->getOrient()), inst->getId(),
+                    numTerms, numBlockages, (int32_t)inst->getInstTerms().size()};
+    if (!inst->getInstTerms().empty()) {
+      rec.instTermBaseId = inst->getInstTerms().front()->getId();
+    }
+    if (!inst->getInstBlockages().empty()) {
+      rec.instBlkBaseId = inst->getInstBlockages().front()->getId();
+    }
+    inst2Idx[inst] = writer.insts.size();
+    writer.insts.push_back(rec);
+  }
+
+  map<frNet*, int> net2Idx;
+  auto addNet = [&](frNet* net, bool isSNet) {
+    snapNet rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.name   = writer.addString(net->getName());
+    rec.id     = net->getId();
+    rec.type   = (int32_t)net->getType();
+    rec.isSNet = isSNet;
+    rec.conns.begin = writer.conns.size();
+    for (auto instTerm: net->getInstTerms()) {
+      auto &uTerms = instTerm->getInst()->getRefBlock()->getTerms();
+      int termIdx = 0;
+      while (uTerms[termIdx].get() != instTerm->getTerm()) {
+        termIdx++;
+      }
+      writer.conns.push_back({inst2Idx[instTerm->getInst()], termIdx});
+    }
+    for (auto term: net->getTerms()) {
+      writer.conns.push_back({-1, term2Idx[term]});
+    }
+    rec.conns.count = writer.conns.size() - rec.conns.begin;
+    rec.pathSegs.begin = writer.pathSegs.size();
+    for (auto &uShape: net->getShapes()) {
+      auto pathSeg = static_cast<frPathSeg*>(uShape.get());
+      frPoint bp, ep;
+      frSegStyle style;
+      pathSeg->getPoints(bp, ep);
+      pathSeg->getStyle(style);
+      writer.pathSegs.push_back({pathSeg->getLayerNum(), bp.x(), bp.y(), ep.x(), ep.y(), style.getWidth(),
+                                 (int32_t)frEndStyleEnum(style.getBeginStyle()), style.getBeginExt(),
+                                 (int32_t)frEndStyleEnum(style.getEndStyle()), style.getEndExt()});
+    }
+    rec.pathSegs.count = writer.pathSegs.size() - rec.pathSegs.begin;
+    rec.vias.begin = writer.vias.size();
+    for (auto &uVia: net->getVias()) {
+      frPoint origin;
+      uVia->getOrigin(origin);
+      int viaDefIdx = 0;
+      while (tech->vias[viaDefIdx].get() != uVia->getViaDef()) {
+        viaDefIdx++;
+      }
+      writer.vias.push_back({viaDefIdx, origin.x(), origin.y()});
+    }
+    rec.vias.count = writer.vias.size() - rec.vias.begin;
+    rec.guides.begin = writer.figs.size();
+    auto it = tmpGuides.find(net);
+    if (it != tmpGuides.end()) {
+      for (auto &rect: it->second) {
+        writer.addFig(&rect, 0);
+      }
+    }
+    rec.guides.count = writer.figs.size() - rec.guides.begin;
+    writer.nets.push_back(rec);
+  };
+  for (auto &uNet: topBlock->getSNets()) {
+    addNet(uNet.get(), true);
+  }
+  for (auto &uNet: topBlock->getNets()) {
+    addNet(uNet.get(), false);
+  }
+
+  for (auto &uBlk: topBlock->getBlockages()) {
+    snapBlockage rec = {uBlk->getId(), {0, 0}};
+    fillFigs(writer, uBlk->getPin(), rec.figs);
+    writer.blockages.push_back(rec);
+  }
+
+  vector<const char*> data;
+  writer.getSection(writer.strings,    header.sections[STRINGS],    data);
+  writer.getSection(writer.points,     header.sections[POINTS],     data);
+  writer.getSection(writer.boundaries, header.sections[BOUNDARIES], data);
+  writer.getSection(writer.tracks,     header.sections[TRACKS],     data);
+  writer.getSection(writer.figs,       header.sections[FIGS],       data);
+  writer.getSection(writer.pins,       header.sections[PINS],       data);
+  writer.getSection(writer.viaDefs,    header.sections[VIADEFS],    data);
+  writer.getSection(writer.terms,      header.sections[TERMS],      data);
+  writer.getSection(writer.insts,      header.sections[INSTS],      data);
+  writer.getSection(writer.nets,       header.sections[NETS],       data);
+  writer.getSection(writer.conns,      header.sections[CONNS],      data);
+  writer.getSection(writer.pathSegs,   header.sections[PATHSEGS],   data);
+  writer.getSection(writer.vias,       header.sections[VIAS],       data);
+  writer.getSection(writer.blockages,  header.sections[BLOCKAGES],  data);
+  // 8-byte aligned sections so every record can be read in place
+  uint64_t offset = sizeof(snapHeader);
+  for (int i = 0; i < NUM_SECTIONS; i++) {
+    offset = (offset + 7) & ~(uint64_t)7;
+    header.sections[i].offset = offset;
+    offset += header.sections[i].count * snapRecordSize[i];
+  }
+
+  // write aside and rename so concurrent runs never see a partial file
+  string tmpFileName = fileName + ".tmp";
+  ofstream fout(tmpFileName.c_str(), ios::binary);
+  if (!fout.is_open()) {
+    cout <<"Warning: cannot write design snapshot " <<tmpFileName <<endl;
+    return;
+  }
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  const char padding[8] = {0};
+  offset = sizeof(snapHeader);
+  for (int i = 0; i < NUM_SECTIONS; i++) {
+    fout.write(padding, header.sections[i].offset - offset);
+    fout.write(data[i], header.sections[i].count * snapRecordSize[i]);
+    offset = header.sections[i].offset + header.sections[i].count * snapRecordSize[i];
+  }
+  fout.close();
+  if (!fout || rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+    cout <<"Warning: cannot write design snapshot " <<fileName <<endl;
+    remove(tmpFileName.c_str());
+    return;
+  }
+  if (VERBOSE > 0) {
+    cout <<endl <<"wrote design snapshot " <<fileName <<" (" <<offset <<" bytes)" <<endl;
+  }
+}
+
+// returns false without touching the design if the snapshot is missing or
+// stale; otherwise reads the LEF and rebuilds the DEF/guide state from it
+bool io::Parser::readSnapshot(const string &fileName) {
+  ProfileTask profile("IO:readSnapshot");
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(snapHeader)) {
+    close(fd);
+    return false;
+  }
+  size_t fileSize = st.st_size;
+  void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+  auto base = static_cast<const char*>(addr);
+  auto header = reinterpret_cast<const snapHeader*>(base);
+  bool isValid = equal(header->magic, header->magic + 4, snapshotMagic) &&
+                 header->version == snapshotVersion &&
+                 header->key == snapshot_getKey();
+  for (int i = 0; isValid && i < NUM_SECTIONS; i++) {
+    auto &section = header->sections[i];
+    isValid = section.offset % 8 == 0 && section.offset <= fileSize &&
+              section.count <= (fileSize - section.offset) / snapRecordSize[i];
+  }
+  auto strings = base + header->sections[STRINGS].offset;
+  isValid = isValid && header->sections[STRINGS].count > header->designName &&
+            strings[header->sections[STRINGS].count - 1] == '\0';
+  if (!isValid) {
+    munmap(addr, fileSize);
+    return false;
+  }
+  auto getSection = [&](snapSectionEnum idx) {
+    return base + header->sections[idx].offset;
+  };
+  auto getCount = [&](snapSectionEnum idx) {
+    return header->sections[idx].count;
+  };
+  auto points     = reinterpret_cast<const snapPoint*>(getSection(POINTS));
+  auto boundaries = reinterpret_cast<const snapBoundary*>(getSection(BOUNDARIES));
+  auto tracks     = reinterpret_cast<const snapTrack*>(getSection(TRACKS));
+  auto figs       = reinterpret_cast<const snapFig*>(getSection(FIGS));
+  auto pins       = reinterpret_cast<const snapPin*>(getSection(PINS));
+  auto viaDefs    = reinterpret_cast<const snapViaDef*>(getSection(VIADEFS));
+  auto terms      = reinterpret_cast<const snapTerm*>(getSection(TERMS));
+  auto insts      = reinterpret_cast<const snapInst*>(getSection(INSTS));
+  auto nets       = reinterpret_cast<const snapNet*>(getSection(NETS));
+  auto conns      = reinterpret_cast<const snapConn*>(getSection(CONNS));
+  auto pathSegs   = reinterpret_cast<const snapPathSeg*>(getSection(PATHSEGS));
+  auto vias       = reinterpret_cast<const snapVia*>(getSection(VIAS));
+  auto blockages  = reinterpret_cast<const snapBlockage*>(getSection(BLOCKAGES));
+
+  // every index and range a record holds must stay inside its section, a
+  // corrupt snapshot is rejected here like a stale one
+  auto isValidString = [&](uint32_t offset) {
+    return offset < getCount(STRINGS);
+  };
+  auto isValidLayer = [&](int32_t layerNum) {
+    return layerNum >= 0 && layerNum < header->numLayers;
+  };
+  isValid = header->numLefVias >= 0 && header->numLayers > 0;
+  for (uint64_t i = 0; isValid && i < getCount(BOUNDARIES); i++) {
+    isValid = isValidRange(boundaries[i].points, getCount(POINTS));
+  }
+  for (uint64_t i = 0; isValid && i < getCount(TRACKS); i++) {
+    isValid = isValidLayer(tracks[i].layerNum);
+  }
+  for (uint64_t i = 0; isValid && i < getCount(FIGS); i++) {
+    isValid = isValidLayer(figs[i].layerNum) && isValidRange(figs[i].points, getCount(POINTS));
+  }
+  for (uint64_t i = 0; isValid && i < getCount(PINS); i++) {
+    isValid = isValidRange(pins[i].figs, getCount(FIGS));
+  }
+  for (uint64_t i = 0; isValid && i < getCount(VIADEFS); i++) {
+    isValid = isValidString(viaDefs[i].name) && isValidRange(viaDefs[i].figs, getCount(FIGS));
+  }
+  for (uint64_t i = 0; isValid && i < getCount(TERMS); i++) {
+    isValid = isValidString(terms[i].name) && isValidRange(terms[i].pins, getCount(PINS));
+  }
+  for (uint64_t i = 0; isValid && i < getCount(INSTS); i++) {
+    isValid = isValidString(insts[i].name) && isValidString(insts[i].refBlockName) &&
+              insts[i].numInstTerms >= 0;
+  }
+  for (uint64_t i = 0; isValid && i < getCount(NETS); i++) {
+    auto &rec = nets[i];
+    isValid = isValidString(rec.name) && isValidRange(rec.conns, getCount(CONNS)) &&
+              isValidRange(rec.pathSegs, getCount(PATHSEGS)) && isValidRange(rec.vias, getCount(VIAS)) &&
+              isValidRange(rec.guides, getCount(FIGS));
+  }
+  for (uint64_t i = 0; isValid && i < getCount(CONNS); i++) {
+    auto &conn = conns[i];
+    if (conn.instIdx == -1) {
+      isValid = conn.termIdx >= 0 && (uint64_t)conn.termIdx < getCount(TERMS);
+    } else {
+      isValid = conn.instIdx >= 0 && (uint64_t)conn.instIdx < getCount(INSTS) &&
+                conn.termIdx >= 0 && conn.termIdx < insts[conn.instIdx].numInstTerms;
+    }
+  }
+  for (uint64_t i = 0; isValid && i < getCount(PATHSEGS); i++) {
+    isValid = isValidLayer(pathSegs[i].layerNum);
+  }
+  for (uint64_t i = 0; isValid && i < getCount(VIAS); i++) {
+    isValid = vias[i].viaDefIdx >= 0 && (uint64_t)vias[i].viaDefIdx < header->numLefVias + getCount(VIADEFS);
+  }
+  for (uint64_t i = 0; isValid && i < getCount(BLOCKAGES); i++) {
+    isValid = isValidRange(blockages[i].figs, getCount(FIGS));
+  }
+  if (!isValid) {
+    cout <<"Warning: design snapshot " <<fileName <<" is corrupt, ignored" <<endl;
+    munmap(addr, fileSize);
+    return false;
+  }
+
+  if (VERBOSE > 0) {
+    cout <<endl <<"reading lef ..." <<endl;
+  }
+  readLef();
+  if ((int)tech->vias.size() != header->numLefVias || numRefBlocks != header->numRefBlocks ||
+      (int)tech->layers.size() != header->numLayers) {
+    cout <<"Error: design snapshot " <<fileName <<" does not match lef" <<endl;
+    exit(1);
+  }
+  numLefVias = header->numLefVias;
+
+  if (VERBOSE > 0) {
+    cout <<endl <<"reading design snapshot " <<fileName <<" ..." <<endl;
+  }
+  tmpBlock = make_unique<frBlock>(string(strings + header->designName));
+  tmpBlock->setDBUPerUU(header->dbu);
+  tmpBlock->trackPatterns.clear();
+  tmpBlock->trackPatterns.resize(tech->layers.size());
+
+  vector<frBoundary> bounds;
+  for (uint64_t i = 0; i < getCount(BOUNDARIES); i++) {
+    frBoundary bound;
+    vector<frPoint> pts;
+    for (uint32_t j = 0; j < boundaries[i].points.count; j++) {
+      auto &pt = points[boundaries[i].points.begin + j];
+      pts.push_back(frPoint(pt.x, pt.y));
+    }
+    bound.setPoints(pts);
+    bounds.push_back(bound);
+  }
+  tmpBlock->setBoundaries(bounds);
+
+  for (uint64_t i = 0; i < getCount(TRACKS); i++) {
+    auto &rec = tracks[i];
+    auto tp = make_unique<frTrackPattern>();
+    tp->setLayerNum(rec.layerNum);
+    tp->setHorizontal(rec.isHorizontal);
+    tp->setStartCoord(rec.startCoord);
+    tp->setNumTracks(rec.numTracks);
+    tp->setTrackSpacing(rec.trackSpacing);
+    tmpBlock->trackPatterns.at(rec.layerNum).push_back(std::move(tp));
+  }
+
+  for (uint64_t i = 0; i < getCount(VIADEFS); i++) {
+    auto &rec = viaDefs[i];
+    auto viaDef = make_unique<frViaDef>(string(strings + rec.name));
+    for (uint32_t j = 0; j < rec.figs.count; j++) {
+      auto &fig = figs[rec.figs.begin + j];
+      auto rect = make_unique<frRect>();
+      rect->setBBox(getFigBox(fig));
+      rect->setLayerNum(fig.layerNum);
+      if (fig.slot == 0) {
+        viaDef->addLayer1Fig(std::move(rect));
+      } else if (fig.slot == 1) {
+        viaDef->addCutFig(std::move(rect));
+      } else {
+        viaDef->addLayer2Fig(std::move(rect));
+      }
+    }
+    tech->addVia(std::move(viaDef));
+  }
+
+  // counts are known up front, size the containers and name indices once
+  tmpBlock->terms.reserve(getCount(TERMS));
+  tmpBlock->name2term.reserve(getCount(TERMS));
+  tmpBlock->insts.reserve(getCount(INSTS));
+  tmpBlock->name2inst.reserve(getCount(INSTS));
+
+  vector<frTerm*> termPtrs;
+  for (uint64_t i = 0; i < getCount(TERMS); i++) {
+    auto &rec = terms[i];
+    auto uTermIn = make_unique<frTerm>(string(strings + rec.name));
+    auto termIn = uTermIn.get();
+    termIn->setId(rec.id);
+    termIn->setType((frTermEnum)rec.type);
+    for (uint32_t j = 0; j < rec.pins.count; j++) {
+      termIn->addPin(getPin(pins[rec.pins.begin + j].figs, figs, points));
+    }
+    termPtrs.push_back(termIn);
+    tmpBlock->addTerm(std::move(uTermIn));
+  }
+
+  vector<frInst*> instPtrs;
+  for (uint64_t i = 0; i < getCount(INSTS); i++) {
+    auto &rec = insts[i];
+    auto it = design->name2refBlock.find(string(strings + rec.refBlockName));
+    if (it == design->name2refBlock.end()) {
+      cout <<"Error: library cell not found!" <<endl;
+      exit(1);
+    }
+    if ((int)it->second->getTerms().size() != rec.numInstTerms) {
+      cout <<"Error: design snapshot " <<fileName <<" does not match lef" <<endl;
+      exit(1);
+    }
+    auto uInst = make_unique<frInst>(string(strings + rec.name), it->second);
+    auto tmpInst = uInst.get();
+    tmpInst->setId(rec.id);
+    tmpInst->setOrigin(frPoint(rec.x, rec.y));
+    tmpInst->setOrient(frOrientEnum(rec.orient));
+    int instTermId = rec.instTermBaseId;
+    for (auto &uTerm: tmpInst->getRefBlock()->getTerms()) {
+      auto term = uTerm.get();
+      auto instTerm = make_unique<frInstTerm>(tmpInst, term);
+      instTerm->setId(instTermId++);
+      instTerm->setAPSize(term->getPins().size());
+      tmpInst->addInstTerm(std::move(instTerm));
+    }
+    int instBlkId = rec.instBlkBaseId;
+    for (auto &uBlk: tmpInst->getRefBlock()->getBlockages()) {
+      auto instBlk = make_unique<frInstBlockage>(tmpInst, uBlk.get());
+      instBlk->setId(instBlkId++);
+      tmpInst->addInstBlockage(std::move(instBlk));
+    }
+    instPtrs.push_back(tmpInst);
+    tmpBlock->addInst(std::move(uInst));
+  }
+
+  for (uint64_t i = 0; i < getCount(NETS); i++) {
+    auto &rec = nets[i];
+    auto uNetIn = make_unique<frNet>(string(strings + rec.name));
+    auto netIn = uNetIn.get();
+    netIn->setId(rec.id);
+    netIn->setType((frNetEnum)rec.type);
+    for (uint32_t j = 0; j < rec.conns.count; j++) {
+      auto &conn = conns[rec.conns.begin + j];
+      if (conn.instIdx == -1) {
+        auto term = termPtrs.at(conn.termIdx);
+        term->addToNet(netIn);
+        netIn->addTerm(term);
+      } else {
+        auto instTerm = instPtrs.at(conn.instIdx)->getInstTerms().at(conn.termIdx).get();
+        instTerm->addToNet(netIn);
+        netIn->addInstTerm(instTerm);
+      }
+    }
+    for (uint32_t j = 0; j < rec.pathSegs.count; j++) {
+      auto &seg = pathSegs[rec.pathSegs.begin + j];
+      auto tmpP = make_unique<frPathSeg>();
+      tmpP->setPoints(frPoint(seg.bx, seg.by), frPoint(seg.ex, seg.ey));
+      tmpP->addToNet(netIn);
+      tmpP->setLayerNum(seg.layerNum);
+      frSegStyle tmpSegStyle;
+      tmpSegStyle.setWidth(seg.width);
+      tmpSegStyle.setBeginStyle(frEndStyle((frEndStyleEnum)seg.beginStyle), seg.beginExt);
+      tmpSegStyle.setEndStyle(frEndStyle((frEndStyleEnum)seg.endStyle), seg.endExt);
+      tmpP->setStyle(tmpSegStyle);
+      netIn->addShape(std::move(tmpP));
+    }
+    for (uint32_t j = 0; j < rec.vias.count; j++) {
+      auto &via = vias[rec.vias.begin + j];
+      auto tmpP = make_unique<frVia>(tech->vias.at(via.viaDefIdx).get());
+      tmpP->setOrigin(frPoint(via.x, via.y));
+      tmpP->addToNet(netIn);
+      netIn->addVia(std::move(tmpP));
+    }
+    if (rec.guides.count) {
+      auto &guides = tmpGuides[netIn];
+      for (uint32_t j = 0; j < rec.guides.count; j++) {
+        auto &fig = figs[rec.guides.begin + j];
+        frRect rect;
+        rect.setBBox(getFigBox(fig));
+        rect.setLayerNum(fig.layerNum);
+        guides.push_back(rect);
+      }
+    }
+    if (rec.isSNet) {
+      tmpBlock->addSNet(std::move(uNetIn));
+    } else {
+      tmpBlock->addNet(std::move(uNetIn));
+    }
+  }
+
+  for (uint64_t i = 0; i < getCount(BLOCKAGES); i++) {
+    auto &rec = blockages[i];
+    auto blkIn = make_unique<frBlockage>();
+    blkIn->setId(rec.id);
+    blkIn->setPin(getPin(rec.figs, figs, points));
+    tmpBlock->addBlockage(std::move(blkIn));
+  }
+  numInsts     = header->numInsts;
+  numTerms     = header->numTerms;
+  numNets      = header->numNets;
+  numBlockages = header->numBlockages;
+  munmap(addr, fileSize);
+
+  tmpBlock->setId(0);
+  design->setTopBlock(std::move(tmpBlock));
+  addFakeNets();
+
+  if (VERBOSE > 0) {
+    cout <<endl;
+    cout <<"design:      " <<design->getTopBlock()->getName()    <<endl;
+    cout <<"defvias:     " <<tech->vias.size() - numLefVias      <<endl;
+    cout <<"#components: " <<design->getTopBlock()->insts.size() <<endl;
+    cout <<"#terminals:  " <<design->getTopBlock()->terms.size() <<endl;
+    cout <<"#snets:      " <<design->getTopBlock()->snets.size() <<endl;
+    cout <<"#nets:       " <<design->getTopBlock()->nets.size()  <<endl;
+    cout <<"#guides:     " <<tmpGuides.size()                    <<endl;
+  }
+  return true;
+}
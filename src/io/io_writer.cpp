@@ -0,0 +1,260 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "frProfileTask.h"
+#include "global.h"
+#include "io/io.h"
+#include "io/io_gzip.h"
+
+using namespace std;
+using namespace fr;
+
+// Streaming DEF writer: everything outside the NETS section is copied from
+// the reference DEF byte for byte, and each net statement keeps its own text
+// except for the regular wiring, which is replaced by the routed connFigs.
+// Only statement boundaries and '+' attributes are tokenized; nothing is
+// handed to the DEF parser.
+namespace {
+  bool isDefSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  }
+
+  // first word of a line, or of an attribute starting at pos
+  string getFirstWord(const char* line, size_t len, size_t pos = 0) {
+    while (pos < len && isDefSpace(line[pos])) {
+      pos++;
+    }
+    size_t begin = pos;
+    while (pos < len && !isDefSpace(line[pos])) {
+      pos++;
+    }
+    return string(line + begin, pos - begin);
+  }
+
+  // regular wiring is what the router replaces; everything else is kept
+  bool isWiringAttr(const string &keyword) {
+    return keyword == "ROUTED" || keyword == "FIXED" || keyword == "COVER" || keyword == "NOSHIELD";
+  }
+}
+
+void io::Writer::writeDef_connFig(string &buf, frConnFig* connFig) {
+  char line[256];
+  if (connFig->typeId() == frcPathSeg) {
+    auto pathSeg = static_cast<frPathSeg*>(connFig);
+    buf += getTech()->getLayer(pathSeg->getLayerNum())->getName();
+    frPoint begin, end;
+    frSegStyle segStyle;
+    pathSeg->getPoints(begin, end);
+    pathSeg->getStyle(segStyle);
+    for (int i = 0; i < 2; i++) {
+      auto &pt = i ? end : begin;
+      auto style = i ? segStyle.getEndStyle() : segStyle.getBeginStyle();
+      auto ext = i ? segStyle.getEndExt() : segStyle.getBeginExt();
+      if (style == frEndStyle(frcExtendEndStyle)) {
+        snprintf(line, sizeof(line), " ( %d %d )", pt.x(), pt.y());
+      } else if (style == frEndStyle(frcTruncateEndStyle)) {
+        snprintf(line, sizeof(line), " ( %d %d 0 )", pt.x(), pt.y());
+      } else {
+        snprintf(line, sizeof(line), " ( %d %d %d )", pt.x(), pt.y(), ext);
+      }
+      buf += line;
+    }
+    buf += "\n";
+  } else if (connFig->typeId() == frcVia) {
+    auto via = static_cast<frVia*>(connFig);
+    frPoint origin;
+    via->getOrigin(origin);
+    buf += getTech()->getLayer(via->getViaDef()->getLayer1Num())->getName();
+    snprintf(line, sizeof(line), " ( %d %d ) ", origin.x(), origin.y());
+    buf += line;
+    buf += via->getViaDef()->getName();
+    buf += "\n";
+  } else if (connFig->typeId() == frcPatchWire) {
+    auto pwire = static_cast<frPatchWire*>(connFig);
+    frPoint origin;
+    frBox offsetBox;
+    pwire->getOrigin(origin);
+    pwire->getOffsetBox(offsetBox);
+    buf += getTech()->getLayer(pwire->getLayerNum())->getName();
+    snprintf(line, sizeof(line), " ( %d %d ) RECT ( %d %d %d %d )\n", origin.x(), origin.y(),
+             offsetBox.left(), offsetBox.bottom(), offsetBox.right(), offsetBox.top());
+    buf += line;
+  } else {
+    cout <<"Error: unknown drt type" <<endl;
+    exit(2);
+  }
+}
+
+// pathsegs, vias and patch wires in the same order the shared_ptr list had
+void io::Writer::fillConnFigs_text(netConnFigs &figs) {
+  int cnt = 0;
+  auto prefix = [&]() {
+    figs.text += cnt ? "    NEW " : "  + ROUTED ";
+    cnt++;
+  };
+  for (auto &pathSeg: figs.pathSegs) {
+    prefix();
+    writeDef_connFig(figs.text, &pathSeg);
+  }
+  for (auto &via: figs.vias) {
+    prefix();
+    writeDef_connFig(figs.text, &via);
+  }
+  for (auto &pwire: figs.patchWires) {
+    prefix();
+    writeDef_connFig(figs.text, &pwire);
+  }
+}
+
+// stmt holds one "- name ... ;" statement of the NETS section
+void io::Writer::writeDef_net(string &buf, const string &stmt) {
+  // split at top-level '+' tokens, skipping quoted strings and comments
+  vector<pair<size_t, size_t> > attrs;
+  size_t attrBegin = 0;
+  bool inQuote = false;
+  size_t end = stmt.rfind(';');
+  for (size_t i = 0; i < end; i++) {
+    char c = stmt[i];
+    if (c == '"') {
+      inQuote = !inQuote;
+    } else if (inQuote) {
+      continue;
+    } else if (c == '+' && (i == 0 || isDefSpace(stmt[i - 1])) && (i + 1 == end || isDefSpace(stmt[i + 1]))) {
+      attrs.push_back(make_pair(attrBegin, i));
+      attrBegin = i;
+    }
+  }
+  attrs.push_back(make_pair(attrBegin, end));
+
+  auto appendTrimmed = [&](size_t begin, size_t end) {
+    while (begin < end && isDefSpace(stmt[begin])) {
+      begin++;
+    }
+    while (end > begin && isDefSpace(stmt[end - 1])) {
+      end--;
+    }
+    buf.append(stmt, begin, end - begin);
+  };
+
+  // "- name ( inst pin ) ..."
+  appendTrimmed(attrs[0].first, attrs[0].second);
+  buf += "\n";
+  auto netName = getFirstWord(stmt.c_str(), end, stmt.find('-') + 1);
+  auto it = net2ConnFigs.find(netName);
+  if (it != net2ConnFigs.end()) {
+    buf += connFigs[it->second].text;
+  }
+  for (int i = 1; i < (int)attrs.size(); i++) {
+    if (isWiringAttr(getFirstWord(stmt.c_str(), attrs[i].second, attrs[i].first + 1))) {
+      continue;
+    }
+    buf += "  ";
+    appendTrimmed(attrs[i].first, attrs[i].second);
+    buf += "\n";
+  }
+  buf += " ;\n";
+}
+
+int io::Writer::writeDef(bool isTA, const string &str) {
+  ProfileTask profile("IO:writeDef");
+  auto outFileName = isTA ? OUTTA_FILE : OUT_FILE + str;
+  // both ends may be gzip; plain files go through zlib unchanged
+  gzFile fin = gzOpenRead(REF_OUT_FILE);
+  if (fin == nullptr) {
+    cout <<"Error: cannot open reference def " <<REF_OUT_FILE <<endl;
+    exit(2);
+  }
+  gzFile fout = gzOpenWrite(outFileName);
+  if (fout == nullptr) {
+    cout <<"Error: cannot open output def " <<outFileName <<endl;
+    exit(2);
+  }
+
+  string lineStr;
+  bool inNets = false;
+  string stmt;
+  string buf;
+  while (gzGetLine(fin, lineStr)) {
+    const char* line = lineStr.c_str();
+    ssize_t len = lineStr.size();
+    if (!inNets) {
+      gzwrite(fout, line, len);
+      inNets = (getFirstWord(line, len) == "NETS");
+      continue;
+    }
+    if (stmt.empty()) {
+      auto keyword = getFirstWord(line, len);
+      if (keyword == "END") {
+        gzwrite(fout, line, len);
+        inNets = false;
+        continue;
+      }
+      if (keyword == "" || keyword[0] == '#') {
+        gzwrite(fout, line, len);
+        continue;
+      }
+    }
+    // accumulate up to the terminating ';' outside quotes and comments
+    bool inQuote = false;
+    bool inComment = false;
+    for (ssize_t i = 0; i < len; i++) {
+      char c = line[i];
+      if (inComment) {
+        if (c == '\n') {
+          stmt.push_back(c);
+        }
+        continue;
+      } else if (c == '"') {
+        inQuote = !inQuote;
+      } else if (!inQuote && c == '#') {
+        inComment = true;
+        continue;
+      } else if (!inQuote && c == ';') {
+        stmt.push_back(c);
+        writeDef_net(buf, stmt);
+        gzwrite(fout, buf.c_str(), buf.size());
+        buf.clear();
+        stmt.clear();
+        continue;
+      }
+      if (!stmt.empty() || !isDefSpace(c)) {
+        stmt.push_back(c);
+      }
+    }
+  }
+  gzclose(fin);
+  if (gzclose(fout) != Z_OK) {
+    cout <<"Error: failed writing output def " <<outFileName <<endl;
+    exit(2);
+  }
+  return 0;
+}
@@ -60,6 +60,10 @@ int readParams(const string &fileName) {
         else if (field == "outputDRC") { DRC_RPT_FILE = value; ++readParamCnt;}
         else if (field == "threads")  { MAX_THREADS = atoi(value.c_str()); ++readParamCnt;}
         else if (field == "verbose")    VERBOSE = atoi(value.c_str());
+        else if (field == "rpCacheDir") RP_CACHE_DIR = value;
+        else if (field == "designSnapshot") DESIGN_SNAPSHOT_FILE = value;
+        else if (field == "metricsFile") METRICS_FILE = value;
+        else if (field == "deterministic") DETERMINISTIC = (atoi(value.c_str()) != 0);
         else if (field == "dbProcessNode") { DBPROCESSNODE = value; ++readParamCnt;}
         else if (field == "drouteOnGridOnlyPrefWireBottomLayerNum") { ONGRIDONLY_WIRE_PREF_BOTTOMLAYERNUM = atoi(value.c_str()); ++readParamCnt;}
         else if (field == "drouteOnGridOnlyPrefWireTopLayerNum") { ONGRIDONLY_WIRE_PREF_TOPLAYERNUM = atoi(value.c_str()); ++readParamCnt;}
@@ -70,6 +74,36 @@ int readParams(const string &fileName) {
         else if (field == "drouteViaInPinBottomLayerNum") { VIAINPIN_BOTTOMLAYERNUM = atoi(value.c_str()); ++readParamCnt;}
         else if (field == "drouteViaInPinTopLayerNum") { VIAINPIN_TOPLAYERNUM = atoi(value.c_str()); ++readParamCnt;}
         else if (field == "drouteEndIterNum") { END_ITERATION = atoi(value.c_str()); ++readParamCnt;}
+        else if (field == "drouteCheckpoint") DR_CHECKPOINT_FILE = value;
+        else if (field == "drouteCheckpointInterval") DR_CHECKPOINT_INTERVAL = atoi(value.c_str());
+        else if (field == "drouteRestartFrom") DR_RESTART_FILE = value;
+        else if (field == "drouteIter") {
+          frDRIterParam param;
+          int followGuide = 0;
+          ss >>param.size >>param.offset >>param.mazeEndIter >>param.drcCost >>param.markerCost
+             >>param.ripupMode >>followGuide;
+          if (ss.fail()) {
+            cout <<"Error: drouteIter expects <size> <offset> <mazeEndIter> <drcCost> <markerCost> <ripupMode> <followGuide>" <<endl;
+            return 2;
+          }
+          param.followGuide = followGuide;
+          DR_SCHEDULE.push_back(param);
+        }
+        else if (field == "drouteWorkerReport") DR_WORKER_REPORT = atoi(value.c_str());
+        else if (field == "drouteNuma") DR_NUMA = (atoi(value.c_str()) != 0);
+        else if (field == "drouteDistListen") DR_DIST_LISTEN = value;
+        else if (field == "drouteDistWorkers") DR_DIST_WORKERS = atoi(value.c_str());
+        else if (field == "drouteDistLeader") DR_DIST_LEADER = value;
+        else if (field == "drouteStopViolations") DR_STOP_VIOLATIONS = atoi(value.c_str());
+        else if (field == "drouteStallWindow") DR_STALL_WINDOW = atoi(value.c_str());
+        else if (field == "drouteStallImprovement") DR_STALL_IMPROVEMENT = atof(value.c_str());
+        else if (field == "drouteStallPolicy") {
+          if (value != "stop" && value != "skip" && value != "escalate") {
+            cout <<"Error: drouteStallPolicy must be stop, skip or escalate" <<endl;
+            return 2;
+          }
+          DR_STALL_POLICY = value;
+        }
         else if (field == "OR_SEED") {OR_SEED = atoi(value.c_str()); ++readParamCnt;}
         else if (field == "OR_K") {OR_K = atof(value.c_str()); ++readParamCnt;}
       }
@@ -87,51 +121,69 @@ int main(int argc, char** argv) {
   using namespace std::chrono;
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   if (argc == 1) {
-    cout <<"Error: usage ./TritonRoute -lef <LEF_FILE> -def <DEF_FILE> -guide <GUIDE_FILE> -output <OUTPUT_DEF>" <<endl;
+    cout <<"Error: usage ./TritonRoute -lef <LEF_FILE> -def <DEF_FILE> -guide <GUIDE_FILE> -output <OUTPUT_DEF> [-restart_from <CHECKPOINT>] [-deterministic] [-dist_leader <ADDR>]" <<endl;
+    cout <<"       -dist_leader and drouteDistListen imply -deterministic" <<endl;
     return 2;
   }
 
-  if (argc == 2) {
-    int readSuccess = readParams(string(argv[1]));
+  argv++;
+  argc--;
+  // a param file may be followed by command line options
+  if (**argv != '-') {
+    int readSuccess = readParams(string(*argv));
     if (readSuccess) {
       cout <<"Error reading param file!!!" <<endl;
       return 2;
     }
-  } else {
     argv++;
     argc--;
-    while (argc--) {
-      if (strcmp(*argv, "-lef") == 0) {
-        argv++;
-        argc--;
-        LEF_FILE = *argv;
-      } else if (strcmp(*argv, "-def") == 0) {
-        argv++;
-        argc--;
-        DEF_FILE = *argv;
-        REF_OUT_FILE = DEF_FILE; 
-      } else if (strcmp(*argv, "-guide") == 0) {
-        argv++;
-        argc--;
-        GUIDE_FILE = *argv;
-      } else if (strcmp(*argv, "-threads") == 0) {
-        argv++;
-        argc--;
-        sscanf(*argv, "%d", &MAX_THREADS);
-      } else if (strcmp(*argv, "-output") == 0) {
-        argv++;
-        argc--;
-        OUT_FILE = *argv;
-      } else if (strcmp(*argv, "-verbose") == 0) {
-        argv++;
-        argc--;
-        VERBOSE = atoi(*argv);
-      } else {
-        cout <<"ERROR: Illegal command line option: " <<*argv <<endl;
-        return 2;
-      }
+  }
+  while (argc--) {
+    if (strcmp(*argv, "-lef") == 0) {
+      argv++;
+      argc--;
+      LEF_FILE = *argv;
+    } else if (strcmp(*argv, "-def") == 0) {
+      argv++;
+      argc--;
+      DEF_FILE = *argv;
+      REF_OUT_FILE = DEF_FILE; 
+    } else if (strcmp(*argv, "-guide") == 0) {
+      argv++;
+      argc--;
+      GUIDE_FILE = *argv;
+    } else if (strcmp(*argv, "-threads") == 0) {
+      argv++;
+      argc--;
+      sscanf(*argv, "%d", &MAX_THREADS);
+    } else if (strcmp(*argv, "-output") == 0) {
       argv++;
+      argc--;
+      OUT_FILE = *argv;
+    } else if (strcmp(*argv, "-verbose") == 0) {
+      argv++;
+      argc--;
+      VERBOSE = atoi(*argv);
+    } else if (strcmp(*argv, "-deterministic") == 0) {
+      DETERMINISTIC = true;
+    } else if (strcmp(*argv, "-restart_from") == 0) {
+      argv++;
+      argc--;
+      DR_RESTART_FILE = *argv;
+    } else if (strcmp(*argv, "-dist_leader") == 0) {
+      argv++;
+      argc--;
+      DR_DIST_LEADER = *argv;
+    } else {
+      cout <<"ERROR: Illegal command line option: " <<*argv <<endl;
+      return 2;
     }
+    argv++;
+  }
+  // leader and workers must route a clip the same way with any thread count
+  if ((DR_DIST_LISTEN != "" || DR_DIST_LEADER != "") && !DETERMINISTIC) {
+    cout <<"Warning: distributed DR runs deterministic" <<endl;
+    DETERMINISTIC = true;
   }
   
   FlexRoute router;
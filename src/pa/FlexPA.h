@@ -36,8 +36,11 @@ namespace gtl = boost::polygon;
 namespace fr {
   // not default via, upperWidth, lowerWidth, not align upper, upperArea, lowerArea, not align lower
   typedef std::tuple<bool, frCoord, frCoord, bool, frCoord, frCoord, bool> viaRawPriorityTuple;
+  // prev unique inst idx, prev pattern idx, curr unique inst idx, curr pattern idx, xOffset, yOffset, same owner
+  typedef std::tuple<int, int, int, int, frCoord, frCoord, bool> instPatternEdgeTuple;
   class FlexPinAccessPattern;
   class FlexDPNode;
+  class FlexGCWorker;
 
   class FlexPA {
   public:
@@ -74,6 +77,7 @@ namespace fr {
     // helper strutures
     std::vector<std::map<frCoord, int> > trackCoords; // 0 -- on grid; 1 -- half-grid; 2 -- center; 3 -- 1/4 grid
     std::map<frLayerNum, std::map<int, std::map<viaRawPriorityTuple, frViaDef*> > > layerNum2ViaDefs;
+    std::map<instPatternEdgeTuple, bool> instPatternEdge2Vio; // memo of inst-level gc results, shared by all rows
 
     // helper functions
     void getPrefTrackPatterns(std::vector<frTrackPattern*> &prefTrackPatterns);
@@ -97,7 +101,8 @@ namespace fr {
     // prep
     void prep();
     void prepPoint();
-    void prepPoint_pin(frPin *pin, frInstTerm* instTerm = nullptr);
+    std::unique_ptr<FlexGCWorker> prepPoint_initGCWorker(frInst* inst);
+    void prepPoint_pin(frPin *pin, frInstTerm* instTerm = nullptr, FlexGCWorker* gcWorker = nullptr);
     void prepPoint_pin_mergePinShapes(std::vector<gtl::polygon_90_set_data<frCoord> > &pinShapes, frPin* pin, frInstTerm* instTerm, bool isShrink = false);
     // type 0 -- on-grid; 1 -- half-grid; 2 -- center; 3 -- via-enc-opt
     void prepPoint_pin_genPoints(std::vector<std::unique_ptr<frAccessPoint> > &aps, std::set<std::pair<frPoint, frLayerNum> > &apset, frPin* pin, 
@@ -121,22 +126,26 @@ namespace fr {
                                                 frCoord x, frCoord y, frLayerNum layerNum, bool allowPlanar, bool allowVia, int lowCost, int highCost);
     void prepPoint_pin_checkPoints(std::vector<std::unique_ptr<frAccessPoint> > &aps, 
                                    const std::vector<gtl::polygon_90_set_data<frCoord> > &pinShapes,
-                                   frPin* pin, frInstTerm* instTerm);
+                                   frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker);
     void prepPoint_pin_checkPoint(frAccessPoint* ap, const gtl::polygon_90_set_data<frCoord> &polyset,
-                                  const std::vector<gtl::polygon_90_data<frCoord> > &polys, frPin* pin, frInstTerm* instTerm);
+                                  const std::vector<gtl::polygon_90_data<frCoord> > &polys, frPin* pin, frInstTerm* instTerm,
+                                  FlexGCWorker* gcWorker);
     void prepPoint_pin_checkPoint_planar(frAccessPoint* ap, const std::vector<gtl::polygon_90_data<frCoord> > &layerPolys, 
-                                         frDirEnum dir, frPin* pin, frInstTerm* instTerm);
+                                         frDirEnum dir, frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker);
     bool prepPoint_pin_checkPoint_planar_ep(frPoint &ep, 
                                             const std::vector<gtl::polygon_90_data<frCoord> > &layerPolys,
                                             const frPoint &bp, frLayerNum layerNum, frDirEnum dir, int stepSizeMultiplier = 2);
     void prepPoint_pin_checkPoint_print_helper(frAccessPoint* ap, frPin* pin, frInstTerm* instTerm, frDirEnum dir, int typeGC, int typeDRC, 
                                                frPoint bp, frPoint ep, frViaDef* viaDef);
-    void prepPoint_pin_checkPoint_via(frAccessPoint* ap, const gtl::polygon_90_set_data<frCoord> &polyset, frDirEnum dir, frPin* pin, frInstTerm* instTerm);
-    bool prepPoint_pin_checkPoint_via_helper(frAccessPoint* ap, frVia* via, frPin* pin, frInstTerm* instTerm);
+    void prepPoint_pin_checkPoint_via(frAccessPoint* ap, const gtl::polygon_90_set_data<frCoord> &polyset, frDirEnum dir, 
+                                      frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker);
+    bool prepPoint_pin_checkPoint_via_helper(frAccessPoint* ap, frVia* via, frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker);
+    bool prepPoint_pin_checkPoint_gc(frConnFig* obj, frBlockObject* owner, const frPoint &bp, 
+                                     frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker);
     void prepPoint_pin_updateStat(const std::vector<std::unique_ptr<frAccessPoint> > &tmpAps, frPin* pin, frInstTerm* instTerm);
     bool prepPoint_pin_helper(std::vector<std::unique_ptr<frAccessPoint> > &aps, std::set<std::pair<frPoint, frLayerNum> > &apset,
                               std::vector<gtl::polygon_90_set_data<frCoord> > &pinShapes,
-                              frPin* pin, frInstTerm* instTerm, int lowerType, int upperType);
+                              frPin* pin, frInstTerm* instTerm, int lowerType, int upperType, FlexGCWorker* gcWorker);
     
     void prepPattern();
     void prepPattern_inst(frInst *inst, int currUniqueInstIdx);
@@ -186,6 +195,10 @@ namespace fr {
                         std::set<frBlockObject*> *owners = nullptr);
     
     void getInsts(std::vector<frInst*> &insts);
+    void prepPattern_splitInstRow(const std::vector<frInst*> &instRow,
+                                  std::vector<std::vector<frInst*> > &instSegs);
+    bool prepPattern_splitInstRow_isIndependent(frInst* prevInst, frInst* currInst);
+    bool prepPattern_splitInstRow_getBoundaryViaBBox(frInst* inst, bool isLeft, frBox &bbox);
     void genInstPattern(std::vector<frInst*> &insts);
     void genInstPattern_init(std::vector<FlexDPNode> &nodes,
                              const std::vector<frInst*> &insts);
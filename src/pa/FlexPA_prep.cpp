@@ -593,7 +593,8 @@ void FlexPA::prepPoint_pin_checkPoint_print_helper(frAccessPoint* ap, frPin* pin
 void FlexPA::prepPoint_pin_checkPoint_planar(frAccessPoint* ap, 
                                              const vector<gtl::polygon_90_data<frCoord> > &layerPolys,
                                              frDirEnum dir,
-                                             frPin* pin, frInstTerm* instTerm) {
+                                             frPin* pin, frInstTerm* instTerm,
+                                             FlexGCWorker* gcWorker) {
   bool enableOutput = false;
   //bool enableOutput = true;
   frPoint bp, ep;
@@ -640,36 +641,23 @@ void FlexPA::prepPoint_pin_checkPoint_planar(frAccessPoint* ap,
   int typeDRC = -1;
 
   // new gcWorker
-  FlexGCWorker gcWorker(getDesign());
-  gcWorker.setIgnoreMinArea();
-  frBox extBox(bp.x() - 3000, bp.y() - 3000, bp.x() + 3000, bp.y() + 3000);
-  gcWorker.setExtBox(extBox);
-  gcWorker.setDrcBox(extBox);
-  if (instTerm) {
-    gcWorker.setTargetObj(instTerm->getInst());
-  } else {
-    gcWorker.setTargetObj(pin->getTerm());
-  }
-  gcWorker.initPA0();
+  frBlockObject* owner = nullptr;
   if (instTerm) {
     if (instTerm->hasNet()) {
-      gcWorker.addPAObj(ps.get(), instTerm->getNet());
+      owner = instTerm->getNet();
     } else {
-      gcWorker.addPAObj(ps.get(), instTerm);
+      owner = instTerm;
     }
   } else {
     if (pin->getTerm()->hasNet()) {
-      gcWorker.addPAObj(ps.get(), pin->getTerm()->getNet());
+      owner = pin->getTerm()->getNet();
     } else {
-      gcWorker.addPAObj(ps.get(), pin->getTerm());
+      owner = pin->getTerm();
     }
   }
-  gcWorker.initPA1();
-  gcWorker.main();
-  gcWorker.end();
 
   int typeGC  = 0;
-  if (gcWorker.getMarkers().empty()) {
+  if (prepPoint_pin_checkPoint_gc(ps.get(), owner, bp, pin, instTerm, gcWorker)) {
     ap->setAccess(dir, true);
     typeGC = 1;
   } else {
@@ -684,7 +672,8 @@ void FlexPA::prepPoint_pin_checkPoint_planar(frAccessPoint* ap,
 void FlexPA::prepPoint_pin_checkPoint_via(frAccessPoint* ap, 
                                           const gtl::polygon_90_set_data<frCoord> &polyset,
                                           frDirEnum dir,
-                                          frPin* pin, frInstTerm* instTerm) {
+                                          frPin* pin, frInstTerm* instTerm,
+                                          FlexGCWorker* gcWorker) {
   //bool enableOutput = false;
   //bool enableOutput = true;
   frPoint bp;
@@ -768,7 +757,7 @@ void FlexPA::prepPoint_pin_checkPoint_via(frAccessPoint* ap,
       }
     }
 
-    if (prepPoint_pin_checkPoint_via_helper(ap, via.get(), pin, instTerm)) {
+    if (prepPoint_pin_checkPoint_via_helper(ap, via.get(), pin, instTerm, gcWorker)) {
       validViaDefs.insert(make_tuple(maxExt, idx, viaDef));
     }
   }
@@ -780,7 +769,8 @@ void FlexPA::prepPoint_pin_checkPoint_via(frAccessPoint* ap,
   }
 }
 
-bool FlexPA::prepPoint_pin_checkPoint_via_helper(frAccessPoint* ap, frVia* via, frPin* pin, frInstTerm* instTerm) {
+bool FlexPA::prepPoint_pin_checkPoint_via_helper(frAccessPoint* ap, frVia* via, frPin* pin, frInstTerm* instTerm,
+                                                 FlexGCWorker* gcWorker) {
   bool enableOutput = false;
   // bool enableOutput = true;
   frPoint bp, ep;
@@ -796,34 +786,20 @@ bool FlexPA::prepPoint_pin_checkPoint_via_helper(frAccessPoint* ap, frVia* via,
   int typeDRC = -1;
 
   // new gcWorker
-  FlexGCWorker gcWorker(getDesign());
-  gcWorker.setIgnoreMinArea();
-  frBox extBox(bp.x() - 3000, bp.y() - 3000, bp.x() + 3000, bp.y() + 3000);
-  gcWorker.setExtBox(extBox);
-  gcWorker.setDrcBox(extBox);
-  if (instTerm) {
-    gcWorker.setTargetObj(instTerm->getInst());
-  } else {
-    gcWorker.setTargetObj(pin->getTerm());
-  }
-
-  gcWorker.initPA0();
+  frBlockObject* owner = nullptr;
   if (instTerm) {
     if (instTerm->hasNet()) {
-      gcWorker.addPAObj(via, instTerm->getNet());
+      owner = instTerm->getNet();
     } else {
-      gcWorker.addPAObj(via, instTerm);
+      owner = instTerm;
     }
   } else {
-    gcWorker.addPAObj(via, pin->getTerm());
+    owner = pin->getTerm();
   }
-  gcWorker.initPA1();
-  gcWorker.main();
-  gcWorker.end();
 
   int typeGC  = 0;
   bool sol = false;
-  if (gcWorker.getMarkers().empty()) {
+  if (prepPoint_pin_checkPoint_gc(via, owner, bp, pin, instTerm, gcWorker)) {
     typeGC = 1;
     sol = true;
   } else {
@@ -845,10 +821,62 @@ bool FlexPA::prepPoint_pin_checkPoint_via_helper(frAccessPoint* ap, frVia* via,
   return sol;
 }
 
+// checks a single access obj (planar stub or via) against the shapes of its own inst / term;
+// gcWorker is the pre-initialized worker of the unique inst if available, otherwise a
+// one-shot worker is built around bp
+bool FlexPA::prepPoint_pin_checkPoint_gc(frConnFig* obj, frBlockObject* owner, const frPoint &bp,
+                                         frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker) {
+  if (gcWorker) {
+    gcWorker->addPAProbe(obj, owner);
+    gcWorker->main();
+    bool sol = gcWorker->getMarkers().empty();
+    gcWorker->removePAProbes();
+    return sol;
+  }
+
+  FlexGCWorker oneShotWorker(getDesign());
+  oneShotWorker.setIgnoreMinArea();
+  frBox extBox(bp.x() - 3000, bp.y() - 3000, bp.x() + 3000, bp.y() + 3000);
+  oneShotWorker.setExtBox(extBox);
+  oneShotWorker.setDrcBox(extBox);
+  if (instTerm) {
+    oneShotWorker.setTargetObj(instTerm->getInst());
+  } else {
+    oneShotWorker.setTargetObj(pin->getTerm());
+  }
+  oneShotWorker.initPA0();
+  oneShotWorker.addPAObj(obj, owner);
+  oneShotWorker.initPA1();
+  oneShotWorker.main();
+  oneShotWorker.end();
+  return oneShotWorker.getMarkers().empty();
+}
+
+// the shapes of an inst do not change during prepPoint, so all access points of a
+// unique inst share one worker holding them; each check only adds and removes its probe.
+// The ext box covers the whole inst instead of 3000 around one probe, so the worker
+// sees every shape of the inst. Each check still runs a full main(), which only
+// covers the shapes of this one inst; restricting it to the probe net with
+// setTargetNet misses the checks made from the neighbouring shapes
+unique_ptr<FlexGCWorker> FlexPA::prepPoint_initGCWorker(frInst* inst) {
+  auto gcWorker = make_unique<FlexGCWorker>(getDesign());
+  gcWorker->setIgnoreMinArea();
+  frBox instBox;
+  inst->getBBox(instBox);
+  frBox extBox(instBox.left() - 3000, instBox.bottom() - 3000, instBox.right() + 3000, instBox.top() + 3000);
+  gcWorker->setExtBox(extBox);
+  gcWorker->setDrcBox(extBox);
+  gcWorker->setTargetObj(inst);
+  gcWorker->initPA0();
+  gcWorker->initPA1();
+  return gcWorker;
+}
+
 void FlexPA::prepPoint_pin_checkPoint(frAccessPoint* ap, 
                                       const gtl::polygon_90_set_data<frCoord> &polyset,
                                       const vector<gtl::polygon_90_data<frCoord> > &polys,
-                                      frPin* pin, frInstTerm* instTerm) {
+                                      frPin* pin, frInstTerm* instTerm,
+                                      FlexGCWorker* gcWorker) {
   bool enableOutput = false;
   // bool enableOutput = true;
   if (enableOutput) {
@@ -863,16 +891,16 @@ void FlexPA::prepPoint_pin_checkPoint(frAccessPoint* ap,
     //}
   }
 
-  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::W, pin, instTerm);
-  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::E, pin, instTerm);
-  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::S, pin, instTerm);
-  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::N, pin, instTerm);
-  prepPoint_pin_checkPoint_via(ap, polyset, frDirEnum::U, pin, instTerm);
+  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::W, pin, instTerm, gcWorker);
+  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::E, pin, instTerm, gcWorker);
+  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::S, pin, instTerm, gcWorker);
+  prepPoint_pin_checkPoint_planar(ap, polys, frDirEnum::N, pin, instTerm, gcWorker);
+  prepPoint_pin_checkPoint_via(ap, polyset, frDirEnum::U, pin, instTerm, gcWorker);
 }
 
 void FlexPA::prepPoint_pin_checkPoints(vector<unique_ptr<frAccessPoint> > &aps, 
                                        const vector<gtl::polygon_90_set_data<frCoord> > &layerPolysets,
-                                       frPin* pin, frInstTerm* instTerm) {
+                                       frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker) {
   vector<vector<gtl::polygon_90_data<frCoord> > > layerPolys(layerPolysets.size());
   for (int i = 0; i < (int)layerPolysets.size(); i++) {
     layerPolysets[i].get_polygons(layerPolys[i]);
@@ -881,7 +909,7 @@ void FlexPA::prepPoint_pin_checkPoints(vector<unique_ptr<frAccessPoint> > &aps,
     auto layerNum = ap->getLayerNum();
     frPoint pt;
     ap->getPoint(pt);
-    prepPoint_pin_checkPoint(ap.get(), layerPolysets[layerNum], layerPolys[layerNum], pin, instTerm);
+    prepPoint_pin_checkPoint(ap.get(), layerPolysets[layerNum], layerPolys[layerNum], pin, instTerm, gcWorker);
   }
 }
 
@@ -922,7 +950,8 @@ void FlexPA::prepPoint_pin_updateStat(const vector<unique_ptr<frAccessPoint> > &
 bool FlexPA::prepPoint_pin_helper(vector<unique_ptr<frAccessPoint> > &aps,
                                   set<pair<frPoint, frLayerNum> > &apset,
                                   vector<gtl::polygon_90_set_data<frCoord> > &pinShapes,
-                                  frPin* pin, frInstTerm* instTerm, int lowerType, int upperType) {
+                                  frPin* pin, frInstTerm* instTerm, int lowerType, int upperType,
+                                  FlexGCWorker* gcWorker) {
   bool isStdCellPin   = (instTerm && (instTerm->getInst()->getRefBlock()->getMacroClass() == MacroClassEnum::CORE ||
                                       instTerm->getInst()->getRefBlock()->getMacroClass() == MacroClassEnum::CORE_TIEHIGH ||
                                       instTerm->getInst()->getRefBlock()->getMacroClass() == MacroClassEnum::CORE_TIELOW || 
@@ -934,7 +963,7 @@ bool FlexPA::prepPoint_pin_helper(vector<unique_ptr<frAccessPoint> > &aps,
   bool isIOPin = (instTerm == nullptr);
   vector<unique_ptr<frAccessPoint> > tmpAps;
   prepPoint_pin_genPoints(tmpAps, apset, pin, instTerm, pinShapes, lowerType, upperType);
-  prepPoint_pin_checkPoints(tmpAps, pinShapes, pin, instTerm);
+  prepPoint_pin_checkPoints(tmpAps, pinShapes, pin, instTerm, gcWorker);
   if (isStdCellPin) {
     #pragma omp atomic
     stdCellPinGenApCnt += tmpAps.size();
@@ -995,7 +1024,7 @@ bool FlexPA::prepPoint_pin_helper(vector<unique_ptr<frAccessPoint> > &aps,
 }
 
 // first create all access points with costs
-void FlexPA::prepPoint_pin(frPin* pin, frInstTerm* instTerm) {
+void FlexPA::prepPoint_pin(frPin* pin, frInstTerm* instTerm, FlexGCWorker* gcWorker) {
   // aps are after xform
   // before checkPoints, ap->hasAccess(dir) indicates whether to check drc 
   vector<unique_ptr<frAccessPoint> > aps;
@@ -1018,62 +1047,62 @@ void FlexPA::prepPoint_pin(frPin* pin, frInstTerm* instTerm) {
 
   // 0 iter, gen on-grid, on-grid points
   //cout <<"iter0" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 0, 0)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 0, 0, gcWorker)) {
     return;
   }
   // 1st iter, gen 1/2-grid, on-grid points
   //cout <<"iter1" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 1, 0)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 1, 0, gcWorker)) {
     return;
   }
   // 2nd iter, gen center, on-grid points
   //cout <<"iter2" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 2, 0)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 2, 0, gcWorker)) {
     return;
   }
   // 3rd iter, gen enc-opt, on-grid points
   //cout <<"iter3" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 3, 0)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 3, 0, gcWorker)) {
     return;
   }
   // 4th iter, gen on-grid, 1/2-grid points
   //cout <<"iter4" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 0, 1)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 0, 1, gcWorker)) {
     return;
   }
   // 5th iter, gen 1/2-grid, 1/2-grid points
   //cout <<"iter5" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 1, 1)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 1, 1, gcWorker)) {
     return;
   }
   // 6th iter, gen center, 1/2-grid points
   //cout <<"iter6" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 2, 1)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 2, 1, gcWorker)) {
     return;
   }
   // 7th iter, gen enc-opt, 1/2-grid points
   //cout <<"iter7" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 3, 1)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 3, 1, gcWorker)) {
     return;
   }
   // 8th iter, gen on-grid, center points
   //cout <<"iter8" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 0, 2)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 0, 2, gcWorker)) {
     return;
   }
   // 9th iter, gen 1/2-grid, center points
   //cout <<"iter9" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 1, 2)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 1, 2, gcWorker)) {
     return;
   }
   // 10th iter, gen center, center points
   //cout <<"iter10" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 2, 2)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 2, 2, gcWorker)) {
     return;
   }
   // 11th iter, gen enc-opt, center points
   //cout <<"iter11" <<endl;
-  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 3, 2)) {
+  if (prepPoint_pin_helper(aps, apset, pinShapes, pin, instTerm, 3, 2, gcWorker)) {
     return;
   }
 
@@ -1141,6 +1170,14 @@ void FlexPA::prepPoint() {
       continue;
     }
     ProfileTask profile("PA:uniqueInstance");
+    // macro pins keep the one-shot check around each access point
+    unique_ptr<FlexGCWorker> gcWorker;
+    if (inst->getRefBlock()->getMacroClass() == MacroClassEnum::CORE || 
+        inst->getRefBlock()->getMacroClass() == MacroClassEnum::CORE_TIEHIGH || 
+        inst->getRefBlock()->getMacroClass() == MacroClassEnum::CORE_TIELOW || 
+        inst->getRefBlock()->getMacroClass() == MacroClassEnum::CORE_ANTENNACELL) {
+      gcWorker = prepPoint_initGCWorker(inst);
+    }
     for (auto &instTerm: inst->getInstTerms()) {
       // only do for normal and clock terms
       if (isSkipInstTerm(instTerm.get())) {
@@ -1151,7 +1188,7 @@ void FlexPA::prepPoint() {
           cout <<"pin prep for " <<inst->getName() <<" / " <<instTerm->getTerm()->getName() 
                <<" " <<inst->getRefBlock()->getName() <<" " <<inst->getOrient() <<endl;
         }
-        prepPoint_pin(pin.get(), instTerm.get());
+        prepPoint_pin(pin.get(), instTerm.get(), gcWorker.get());
       }
       #pragma omp critical 
       {
@@ -1294,8 +1331,21 @@ void FlexPA::prepPattern() {
     instRows.push_back(rowInsts);
   }
 
+  // split rows at insts whose boundary access points cannot interact,
+  // long rows otherwise keep a single thread busy till the end
+  std::vector<std::vector<frInst*> > instSegs;
+  for (auto &instRow: instRows) {
+    prepPattern_splitInstRow(instRow, instSegs);
+  }
+  // longest segments first so that they do not start last
+  std::stable_sort(instSegs.begin(), instSegs.end(), 
+                   [](const std::vector<frInst*> &a, const std::vector<frInst*> &b) {
+                     return a.size() > b.size();
+                   });
+
   if (enableOutput) {
-    cout << "gen inst row access patterns...\n" << flush;
+    cout << "gen inst row access patterns (" << instRows.size() << " rows, " 
+         << instSegs.size() << " segments)...\n" << flush;
   }
   // choose access pattern of a row of insts
   int rowIdx = 0;
@@ -1303,9 +1353,9 @@ void FlexPA::prepPattern() {
   // for (auto &instRow: instRows) {
   omp_set_num_threads(MAX_THREADS);
   #pragma omp parallel for schedule(dynamic)
-  for (int i = 0; i < (int)instRows.size(); i++) {
-    auto &instRow = instRows[i];
-    genInstPattern(instRow);
+  for (int i = 0; i < (int)instSegs.size(); i++) {
+    auto &instSeg = instSegs[i];
+    genInstPattern(instSeg);
     #pragma omp critical
     {
       if (enableOutput) {
@@ -1332,9 +1382,72 @@ void FlexPA::prepPattern() {
 
   if (enableOutput) {
     cout << "GC called " << gcCallCnt << " times\n";
+    cout << "#cached inst pattern edges = " << instPatternEdge2Vio.size() << "\n";
   }
 }
 
+// insts must be in the same row and sorted from left to right
+void FlexPA::prepPattern_splitInstRow(const std::vector<frInst*> &instRow,
+                                      std::vector<std::vector<frInst*> > &instSegs) {
+  std::vector<frInst*> instSeg;
+  for (auto inst: instRow) {
+    if (!instSeg.empty() && prepPattern_splitInstRow_isIndependent(instSeg.back(), inst)) {
+      instSegs.push_back(instSeg);
+      instSeg.clear();
+    }
+    instSeg.push_back(inst);
+  }
+  if (!instSeg.empty()) {
+    instSegs.push_back(instSeg);
+  }
+}
+
+// true if no access pattern of prevInst can interact with any access pattern of currInst,
+// i.e., every pattern has a boundary via and the vias are more than DRCSAFEDIST apart
+bool FlexPA::prepPattern_splitInstRow_isIndependent(frInst* prevInst, frInst* currInst) {
+  frBox prevBox, currBox;
+  if (!prepPattern_splitInstRow_getBoundaryViaBBox(prevInst, false, prevBox) ||
+      !prepPattern_splitInstRow_getBoundaryViaBBox(currInst, true, currBox)) {
+    return false;
+  }
+  frCoord distX = std::max(currBox.left() - prevBox.right(), prevBox.left() - currBox.right());
+  frCoord distY = std::max(currBox.bottom() - prevBox.top(), prevBox.bottom() - currBox.top());
+  return std::max(distX, distY) > DRCSAFEDIST;
+}
+
+// bbox of the left / right boundary vias over all access patterns of the inst,
+// false if any pattern has no boundary via
+bool FlexPA::prepPattern_splitInstRow_getBoundaryViaBBox(frInst* inst, bool isLeft, frBox &bbox) {
+  auto uniqueInstIdx = unique2Idx[inst2unique[inst]];
+  auto &instPatterns = uniqueInstPatterns[uniqueInstIdx];
+  if (instPatterns.empty()) {
+    return false;
+  }
+  frTransform xform;
+  inst->getUpdatedXform(xform, true);
+  bool isFirst = true;
+  for (auto &accessPattern: instPatterns) {
+    auto accessPoint = accessPattern->getBoundaryAP(isLeft);
+    if (accessPoint == nullptr || !accessPoint->hasAccess(frDirEnum::U)) {
+      return false;
+    }
+    frVia via(accessPoint->getViaDef());
+    frPoint pt(accessPoint->getPoint());
+    pt.transform(xform);
+    via.setOrigin(pt);
+    frBox viaBox;
+    via.getBBox(viaBox);
+    if (isFirst) {
+      bbox.set(viaBox);
+      isFirst = false;
+    } else {
+      bbox.set(std::min(bbox.left(),  viaBox.left()),  std::min(bbox.bottom(), viaBox.bottom()),
+               std::max(bbox.right(), viaBox.right()), std::max(bbox.top(),    viaBox.top()));
+    }
+  }
+  return true;
+}
+
 void FlexPA::revertAccessPoints() {
   for (auto &inst: uniqueInstances) {
     frTransform xform, revertXform;
@@ -1624,7 +1737,31 @@ int FlexPA::getEdgeCost(int prevNodeIdx, int currNodeIdx,
   addAccessPatternObj(prevInst, prevPinAccessPattern, objs, tempVias, true);
   addAccessPatternObj(currInst, currPinAccessPattern, objs, tempVias, false);
 
-  hasVio = !genPatterns_gc(nullptr, objs);
+  // the check only sees the two boundary vias, so the result is the same for
+  // every pair of insts with the same unique insts, patterns and relative offset
+  frTransform prevXform, currXform;
+  prevInst->getUpdatedXform(prevXform, true);
+  currInst->getUpdatedXform(currXform, true);
+  bool isSameOwner = (objs.size() == 2 && objs[0].second == objs[1].second);
+  instPatternEdgeTuple edgeKey(prevUniqueInstIdx, prevIdx2, currUniqueInstIdx, currIdx2,
+                               currXform.xOffset() - prevXform.xOffset(),
+                               currXform.yOffset() - prevXform.yOffset(), isSameOwner);
+  bool isCached = false;
+  #pragma omp critical (instPatternEdge2Vio)
+  {
+    auto it = instPatternEdge2Vio.find(edgeKey);
+    if (it != instPatternEdge2Vio.end()) {
+      hasVio = it->second;
+      isCached = true;
+    }
+  }
+  if (!isCached) {
+    hasVio = !genPatterns_gc(nullptr, objs);
+    #pragma omp critical (instPatternEdge2Vio)
+    {
+      instPatternEdge2Vio[edgeKey] = hasVio;
+    }
+  }
   if (!hasVio) {
     int prevNodeCost = nodes[prevNodeIdx].getNodeCost();
     int currNodeCost = nodes[currNodeIdx].getNodeCost();
@@ -39,6 +39,22 @@ using namespace fr;
 void FlexRP::main() {
   ProfileTask profile("RP:main");
   init();
+
+  string cacheFile;
+  if (RP_CACHE_DIR != "") {
+    cacheFile = cache_getFileName();
+  }
+  if (cacheFile != "" && cache_read(cacheFile)) {
+    if (VERBOSE > 0) {
+      cout <<"  loaded rp tables from " <<cacheFile <<endl;
+    }
+    return;
+  }
+
   prep();
+
+  if (cacheFile != "") {
+    cache_write(cacheFile);
+  }
 }
 
@@ -29,6 +29,7 @@
 #ifndef _FR_FLEXRP_H_
 #define _FR_FLEXRP_H_
 
+#include <cstdint>
 #include "frDesign.h"
 #include <boost/icl/interval_set.hpp>
 
@@ -46,6 +47,7 @@ namespace fr {
   protected:
     frDesign* design;
     frTechObject* tech;
+    std::vector<frLayerNum> routingLayerNums; // routing layers in table order
 
     // init
     void init();
@@ -56,27 +58,33 @@ namespace fr {
     // end
     void end();
 
+    // on-disk table cache keyed by tech hash
+    std::string cache_getFileName();
+    std::uint64_t cache_getTechHash();
+    bool cache_read(const std::string &fileName);
+    void cache_write(const std::string &fileName);
+
     // functions
-    void prep_viaForbiddenThrough();
+    void prep_viaForbiddenThrough(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
     void prep_viaForbiddenThrough_helper(const frLayerNum &lNum, const int &tableLayerIdx, const int &tableEntryIdx,
                                          frViaDef* viaDef, bool isCurrDirX);
     bool prep_viaForbiddenThrough_minStep(const frLayerNum &lNum, frViaDef* viaDef, bool isCurrDirX);
-    void prep_lineForbiddenLen();
+    void prep_lineForbiddenLen(const frLayerNum &lNum, const int &tableLayerIdx);
     void prep_lineForbiddenLen_helper(const frLayerNum &lNum, const int &tableLayerIdx, const int &tableEntryIdx,
                                       const bool isZShape, const bool isCurrDirX);
     void prep_lineForbiddenLen_minSpc(const frLayerNum &lNum, const bool isZShape, const bool isCurrDirX,
                                       std::vector<std::pair<frCoord, frCoord> > &forbiddenRanges);
-    void prep_viaForbiddenPlanarLen();
+    void prep_viaForbiddenPlanarLen(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
     void prep_viaForbiddenPlanarLen_helper(const frLayerNum &lNum, const int &tableLayerIdx, const int &tableEntryIdx,
                                            frViaDef *viaDef, bool isCurrDirX);
     void prep_viaForbiddenPlanarLen_minStep(const frLayerNum &lNum, frViaDef *viaDef, bool isCurrDirX, 
                                             std::vector<std::pair<frCoord, frCoord> > &forbiddenRanges);
-    void prep_viaForbiddenTurnLen();
+    void prep_viaForbiddenTurnLen(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
     void prep_viaForbiddenTurnLen_helper(const frLayerNum &lNum, const int &tableLayerIdx, const int &tableEntryIdx,
                                          frViaDef *viaDef, bool isCurrDirX);
     void prep_viaForbiddenTurnLen_minSpc(const frLayerNum &lNum, frViaDef *viaDef, bool isCurrDirX,
                                          std::vector<std::pair<frCoord, frCoord> > &forbiddenRanges);
-    void prep_via2viaForbiddenLen();
+    void prep_via2viaForbiddenLen(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
     void prep_via2viaForbiddenLen_helper(const frLayerNum &lNum, const int &tableLayerIdx, const int &tableEntryIdx,
                                          frViaDef *viaDef1, frViaDef *viaDef2, bool isCurrDirX);
     void prep_via2viaForbiddenLen_minStep(const frLayerNum &lNum, frViaDef *viaDef1, frViaDef *viaDef2,
@@ -91,6 +99,21 @@ namespace fr {
                                               bool isCurrDirX, std::vector<std::pair<frCoord, frCoord> > &forbiddenRanges);
     void prep_via2viaForbiddenLen_lef58CutSpc_helper(const frBox &enclosureBox1, const frBox &enclosureBox2, const frBox &cutBox,
                                                      frCoord reqSpcVal, std::pair<frCoord, frCoord> &range);
+
+    // min length tables for dr
+    void prep_halfViaEncArea(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* upVia);
+    void prep_via2viaMinLen(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
+    frCoord prep_via2viaMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2);
+    frCoord prep_via2viaMinLen_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2);
+    bool prep_via2viaMinLen_minimumcut2(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2);
+    void prep_via2viaMinLenNew(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
+    frCoord prep_via2viaMinLenNew_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY);
+    frCoord prep_via2viaMinLenNew_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY);
+    frCoord prep_via2viaMinLenNew_cutSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY);
+    void prep_via2turnMinLen(const frLayerNum &lNum, const int &tableLayerIdx, frViaDef* downVia, frViaDef* upVia);
+    frCoord prep_via2turnMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY);
+    frCoord prep_via2turnMinLen_minStp(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY);
+    void prep_minLen_print();
   };
 }
 
@@ -0,0 +1,251 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "frProfileTask.h"
+#include "FlexRP.h"
+#include "db/infra/frHash.h"
+#include "io/io_gzip.h"
+
+using namespace std;
+using namespace fr;
+
+namespace {
+  // bump whenever the table layout or any prep_* rule changes
+  const uint32_t rpCacheVersion = 2;
+  const char rpCacheMagic[4] = {'F', 'R', 'R', 'P'};
+
+  template <typename T>
+  void writeVal(ofstream &fout, const T &val) {
+    fout.write(reinterpret_cast<const char*>(&val), sizeof(T));
+  }
+
+  template <typename T>
+  bool readVal(ifstream &fin, T &val) {
+    return (bool)fin.read(reinterpret_cast<char*>(&val), sizeof(T));
+  }
+
+  void writeRanges(ofstream &fout, const vector<pair<frCoord, frCoord> > &ranges) {
+    writeVal(fout, (uint32_t)ranges.size());
+    for (auto &range: ranges) {
+      writeVal(fout, range.first);
+      writeVal(fout, range.second);
+    }
+  }
+
+  // flat tables are sized by init(), so only the payload is stored
+  template <typename T>
+  void writeFlat(ofstream &fout, const vector<T> &table) {
+    fout.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(T));
+  }
+
+  template <typename T>
+  bool readFlat(ifstream &fin, vector<T> &table) {
+    return (bool)fin.read(reinterpret_cast<char*>(table.data()), table.size() * sizeof(T));
+  }
+
+  bool readRanges(ifstream &fin, vector<pair<frCoord, frCoord> > &ranges) {
+    uint32_t size = 0;
+    if (!readVal(fin, size)) {
+      return false;
+    }
+    ranges.resize(size);
+    for (auto &range: ranges) {
+      if (!readVal(fin, range.first) || !readVal(fin, range.second)) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+// tables depend only on the tech section of the LEF (everything before the
+// first MACRO) and on which via def was picked as default for each layer
+uint64_t FlexRP::cache_getTechHash() {
+  // read like the parser, so a compressed LEF hashes its text
+  gzFile fin = io::gzOpenRead(LEF_FILE);
+  if (fin == nullptr) {
+    return 0;
+  }
+  uint64_t hash = frHashSeed;
+  frHashBytes(hash, &rpCacheVersion, sizeof(rpCacheVersion));
+  string line;
+  while (io::gzGetLine(fin, line)) {
+    if (line.back() == '\n') {
+      line.pop_back();
+    }
+    stringstream ss(line);
+    string keyword;
+    ss >> keyword;
+    if (keyword == "MACRO") {
+      break;
+    }
+    frHashString(hash, line);
+  }
+  gzclose(fin);
+
+  for (auto lNum: routingLayerNums) {
+    frHashString(hash, tech->getLayer(lNum)->getName());
+    for (auto viaLNum: {lNum - 1, lNum + 1}) {
+      frViaDef* viaDef = nullptr;
+      if (viaLNum >= tech->getBottomLayerNum() && viaLNum <= tech->getTopLayerNum()) {
+        viaDef = tech->getLayer(viaLNum)->getDefaultViaDef();
+      }
+      frHashString(hash, viaDef ? viaDef->getName() : string(""));
+    }
+  }
+  return hash;
+}
+
+string FlexRP::cache_getFileName() {
+  auto hash = cache_getTechHash();
+  if (hash == 0) {
+    return string("");
+  }
+  stringstream ss;
+  ss <<RP_CACHE_DIR <<"/rp_" <<hex <<setw(16) <<setfill('0') <<hash <<".bin";
+  return ss.str();
+}
+
+bool FlexRP::cache_read(const string &fileName) {
+  ProfileTask profile("RP:cache_read");
+  ifstream fin(fileName.c_str(), ios::binary);
+  if (!fin.is_open()) {
+    return false;
+  }
+  char magic[4];
+  uint32_t version = 0;
+  uint32_t numLayers = 0;
+  if (!fin.read(magic, 4) || !equal(magic, magic + 4, rpCacheMagic) ||
+      !readVal(fin, version) || version != rpCacheVersion ||
+      !readVal(fin, numLayers) || numLayers != routingLayerNums.size()) {
+    return false;
+  }
+
+  // read into copies so a truncated file leaves the tech untouched
+  auto via2ViaForbiddenLen        = tech->via2ViaForbiddenLen;
+  auto via2ViaForbiddenOverlapLen = tech->via2ViaForbiddenOverlapLen;
+  auto viaForbiddenTurnLen        = tech->viaForbiddenTurnLen;
+  auto viaForbiddenPlanarLen      = tech->viaForbiddenPlanarLen;
+  auto line2LineForbiddenLen      = tech->line2LineForbiddenLen;
+  auto viaForbiddenThrough        = tech->viaForbiddenThrough;
+  auto halfViaEncArea             = tech->halfViaEncArea;
+  auto via2ViaMinLen              = tech->via2ViaMinLen;
+  auto via2ViaZeroLen             = tech->via2ViaZeroLen;
+  auto via2ViaMinLenNew           = tech->via2ViaMinLenNew;
+  auto via2TurnMinLen             = tech->via2TurnMinLen;
+  for (uint32_t i = 0; i < numLayers; i++) {
+    for (auto &ranges: via2ViaForbiddenLen[i]) {
+      if (!readRanges(fin, ranges)) return false;
+    }
+    for (auto &ranges: via2ViaForbiddenOverlapLen[i]) {
+      if (!readRanges(fin, ranges)) return false;
+    }
+    for (auto &ranges: viaForbiddenTurnLen[i]) {
+      if (!readRanges(fin, ranges)) return false;
+    }
+    for (auto &ranges: viaForbiddenPlanarLen[i]) {
+      if (!readRanges(fin, ranges)) return false;
+    }
+    for (auto &ranges: line2LineForbiddenLen[i]) {
+      if (!readRanges(fin, ranges)) return false;
+    }
+    for (int j = 0; j < (int)viaForbiddenThrough[i].size(); j++) {
+      char isForbidden = 0;
+      if (!readVal(fin, isForbidden)) return false;
+      viaForbiddenThrough[i][j] = isForbidden;
+    }
+  }
+  if (!readFlat(fin, halfViaEncArea) || !readFlat(fin, via2ViaMinLen) ||
+      !readFlat(fin, via2ViaZeroLen) || !readFlat(fin, via2ViaMinLenNew) ||
+      !readFlat(fin, via2TurnMinLen)) {
+    return false;
+  }
+  fin.close();
+
+  tech->via2ViaForbiddenLen        = std::move(via2ViaForbiddenLen);
+  tech->via2ViaForbiddenOverlapLen = std::move(via2ViaForbiddenOverlapLen);
+  tech->viaForbiddenTurnLen        = std::move(viaForbiddenTurnLen);
+  tech->viaForbiddenPlanarLen      = std::move(viaForbiddenPlanarLen);
+  tech->line2LineForbiddenLen      = std::move(line2LineForbiddenLen);
+  tech->viaForbiddenThrough        = std::move(viaForbiddenThrough);
+  tech->halfViaEncArea             = std::move(halfViaEncArea);
+  tech->via2ViaMinLen              = std::move(via2ViaMinLen);
+  tech->via2ViaZeroLen             = std::move(via2ViaZeroLen);
+  tech->via2ViaMinLenNew           = std::move(via2ViaMinLenNew);
+  tech->via2TurnMinLen             = std::move(via2TurnMinLen);
+  return true;
+}
+
+void FlexRP::cache_write(const string &fileName) {
+  ProfileTask profile("RP:cache_write");
+  // write aside and rename so concurrent runs never see a partial file
+  string tmpFileName = fileName + ".tmp";
+  ofstream fout(tmpFileName.c_str(), ios::binary);
+  if (!fout.is_open()) {
+    cout <<"Warning: cannot write rp cache " <<tmpFileName <<endl;
+    return;
+  }
+  fout.write(rpCacheMagic, 4);
+  writeVal(fout, rpCacheVersion);
+  writeVal(fout, (uint32_t)routingLayerNums.size());
+  for (int i = 0; i < (int)routingLayerNums.size(); i++) {
+    for (auto &ranges: tech->via2ViaForbiddenLen[i]) {
+      writeRanges(fout, ranges);
+    }
+    for (auto &ranges: tech->via2ViaForbiddenOverlapLen[i]) {
+      writeRanges(fout, ranges);
+    }
+    for (auto &ranges: tech->viaForbiddenTurnLen[i]) {
+      writeRanges(fout, ranges);
+    }
+    for (auto &ranges: tech->viaForbiddenPlanarLen[i]) {
+      writeRanges(fout, ranges);
+    }
+    for (auto &ranges: tech->line2LineForbiddenLen[i]) {
+      writeRanges(fout, ranges);
+    }
+    for (int j = 0; j < (int)tech->viaForbiddenThrough[i].size(); j++) {
+      writeVal(fout, (char)tech->viaForbiddenThrough[i][j]);
+    }
+  }
+  writeFlat(fout, tech->halfViaEncArea);
+  writeFlat(fout, tech->via2ViaMinLen);
+  writeFlat(fout, tech->via2ViaZeroLen);
+  writeFlat(fout, tech->via2ViaMinLenNew);
+  writeFlat(fout, tech->via2TurnMinLen);
+  fout.close();
+  if (!fout || rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+    cout <<"Warning: cannot write rp cache " <<fileName <<endl;
+    remove(tmpFileName.c_str());
+  }
+}
@@ -58,7 +58,14 @@ void FlexRP::init() {
     tech->viaForbiddenPlanarLen.push_back(fourForbiddenRanges);
     tech->line2LineForbiddenLen.push_back(fourForbiddenRanges);
     tech->viaForbiddenThrough.push_back(fourForbidden);
+    routingLayerNums.push_back(lNum);
   }
+  int numLayers = routingLayerNums.size();
+  tech->halfViaEncArea.assign(numLayers * 2, 0);
+  tech->via2ViaMinLen.assign(numLayers * 4, 0);
+  tech->via2ViaZeroLen.assign(numLayers * 4, 1);
+  tech->via2ViaMinLenNew.assign(numLayers * 8, 0);
+  tech->via2TurnMinLen.assign(numLayers * 4, 0);
 
   if (enableOutput) {
     cout << "tech->via2ViaForbiddenLen size = " << tech->via2ViaForbiddenLen.size() << "\n";
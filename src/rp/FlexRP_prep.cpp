@@ -28,6 +28,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <omp.h>
 #include "frProfileTask.h"
 #include "FlexRP.h"
 #include "db/infra/frTime.h"
@@ -38,23 +39,12 @@ using namespace fr;
 
 void FlexRP::prep() {
   ProfileTask profile("RP:prep");
-  prep_via2viaForbiddenLen();
-  prep_viaForbiddenTurnLen();
-  prep_viaForbiddenPlanarLen();
-  prep_lineForbiddenLen();
-  prep_viaForbiddenThrough();
-}
-
-void FlexRP::prep_viaForbiddenThrough() {
-  // bool enableOutput = false;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
-
-  int i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (tech->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
+  bool enableOutput = true;
+  // every table row is owned by one routing layer, so layers run in parallel
+  omp_set_num_threads(MAX_THREADS);
+  #pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int)routingLayerNums.size(); i++) {
+    auto lNum = routingLayerNums[i];
     frViaDef* downVia = nullptr;
     frViaDef* upVia = nullptr;
     if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
@@ -63,14 +53,31 @@ void FlexRP::prep_viaForbiddenThrough() {
     if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
       upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
     }
-    prep_viaForbiddenThrough_helper(lNum, i, 0, downVia, true );
-    prep_viaForbiddenThrough_helper(lNum, i, 1, downVia, false);
-    prep_viaForbiddenThrough_helper(lNum, i, 2, upVia,   true );
-    prep_viaForbiddenThrough_helper(lNum, i, 3, upVia,   false);
-    i++;
+    // forbidden length tables
+    prep_via2viaForbiddenLen(lNum, i, downVia, upVia);
+    prep_viaForbiddenTurnLen(lNum, i, downVia, upVia);
+    prep_viaForbiddenPlanarLen(lNum, i, downVia, upVia);
+    prep_lineForbiddenLen(lNum, i);
+    prep_viaForbiddenThrough(lNum, i, downVia, upVia);
+    // min length tables
+    prep_halfViaEncArea(lNum, i, upVia);
+    prep_via2viaMinLen(lNum, i, downVia, upVia);
+    prep_via2viaMinLenNew(lNum, i, downVia, upVia);
+    prep_via2turnMinLen(lNum, i, downVia, upVia);
+  }
+
+  if (enableOutput) {
+    prep_minLen_print();
   }
 }
 
+void FlexRP::prep_viaForbiddenThrough(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  prep_viaForbiddenThrough_helper(lNum, i, 0, downVia, true );
+  prep_viaForbiddenThrough_helper(lNum, i, 1, downVia, false);
+  prep_viaForbiddenThrough_helper(lNum, i, 2, upVia,   true );
+  prep_viaForbiddenThrough_helper(lNum, i, 3, upVia,   false);
+}
+
 void FlexRP::prep_viaForbiddenThrough_helper(const frLayerNum &lNum,
                                              const int &tableLayerIdx,
                                              const int &tableEntryIdx,
@@ -99,23 +106,11 @@ bool FlexRP::prep_viaForbiddenThrough_minStep(const frLayerNum &lNum,
   }
 }
 
-void FlexRP::prep_lineForbiddenLen() {
-  // bool enableOutput = false;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
-
-  int i = 0; 
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (tech->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    prep_lineForbiddenLen_helper(lNum, i, 0, true , true );
-    prep_lineForbiddenLen_helper(lNum, i, 1, true , false);
-    prep_lineForbiddenLen_helper(lNum, i, 2, false, true );
-    prep_lineForbiddenLen_helper(lNum, i, 3, false, false);
-
-    i++;
-  }
+void FlexRP::prep_lineForbiddenLen(const frLayerNum &lNum, const int &i) {
+  prep_lineForbiddenLen_helper(lNum, i, 0, true , true );
+  prep_lineForbiddenLen_helper(lNum, i, 1, true , false);
+  prep_lineForbiddenLen_helper(lNum, i, 2, false, true );
+  prep_lineForbiddenLen_helper(lNum, i, 3, false, false);
 }
 
 void FlexRP::prep_lineForbiddenLen_helper(const frLayerNum &lNum,
@@ -172,31 +167,11 @@ void FlexRP::prep_lineForbiddenLen_minSpc(const frLayerNum &lNum,
 
 
 
-void FlexRP::prep_viaForbiddenPlanarLen() {
-  // bool enableOutput = false;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
-
-  int i = 0;
-  for  (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    prep_viaForbiddenPlanarLen_helper(lNum, i, 0, downVia, true );
-    prep_viaForbiddenPlanarLen_helper(lNum, i, 1, downVia, false);
-    prep_viaForbiddenPlanarLen_helper(lNum, i, 2, upVia  , true );
-    prep_viaForbiddenPlanarLen_helper(lNum, i, 3, upVia  , false);
-
-    i++;
-  }
+void FlexRP::prep_viaForbiddenPlanarLen(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  prep_viaForbiddenPlanarLen_helper(lNum, i, 0, downVia, true );
+  prep_viaForbiddenPlanarLen_helper(lNum, i, 1, downVia, false);
+  prep_viaForbiddenPlanarLen_helper(lNum, i, 2, upVia  , true );
+  prep_viaForbiddenPlanarLen_helper(lNum, i, 3, upVia  , false);
 }
 
 void FlexRP::prep_viaForbiddenPlanarLen_helper(const frLayerNum &lNum, 
@@ -234,31 +209,11 @@ void FlexRP::prep_viaForbiddenPlanarLen_minStep(const frLayerNum &lNum,
   return;
 }
 
-void FlexRP::prep_viaForbiddenTurnLen() {
-  // bool enableOutput = false;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
-
-  int i = 0; 
-  for  (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    prep_viaForbiddenTurnLen_helper(lNum, i, 0, downVia, true );
-    prep_viaForbiddenTurnLen_helper(lNum, i, 1, downVia, false);
-    prep_viaForbiddenTurnLen_helper(lNum, i, 2, upVia,   true );
-    prep_viaForbiddenTurnLen_helper(lNum, i, 3, upVia,   false);
-
-    i++;
-  }
+void FlexRP::prep_viaForbiddenTurnLen(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  prep_viaForbiddenTurnLen_helper(lNum, i, 0, downVia, true );
+  prep_viaForbiddenTurnLen_helper(lNum, i, 1, downVia, false);
+  prep_viaForbiddenTurnLen_helper(lNum, i, 2, upVia,   true );
+  prep_viaForbiddenTurnLen_helper(lNum, i, 3, upVia,   false);
 }
 
 // forbidden turn length range from via
@@ -336,35 +291,15 @@ void FlexRP::prep_viaForbiddenTurnLen_minSpc(const frLayerNum &lNum,
   }
 }
 
-void FlexRP::prep_via2viaForbiddenLen() {
-  // bool enableOutput = false;
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
-
-  int i = 0; 
-  for  (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType() != frLayerTypeEnum::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia = nullptr;
-    if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-    }
-    prep_via2viaForbiddenLen_helper(lNum, i, 0, downVia, downVia, true );
-    prep_via2viaForbiddenLen_helper(lNum, i, 1, downVia, downVia, false);
-    prep_via2viaForbiddenLen_helper(lNum, i, 2, downVia, upVia,   true );
-    prep_via2viaForbiddenLen_helper(lNum, i, 3, downVia, upVia,   false);
-    prep_via2viaForbiddenLen_helper(lNum, i, 4, upVia,   downVia, true );
-    prep_via2viaForbiddenLen_helper(lNum, i, 5, upVia,   downVia, false);
-    prep_via2viaForbiddenLen_helper(lNum, i, 6, upVia,   upVia,   true );
-    prep_via2viaForbiddenLen_helper(lNum, i, 7, upVia,   upVia,   false);
-
-    i++;
-  }
+void FlexRP::prep_via2viaForbiddenLen(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  prep_via2viaForbiddenLen_helper(lNum, i, 0, downVia, downVia, true );
+  prep_via2viaForbiddenLen_helper(lNum, i, 1, downVia, downVia, false);
+  prep_via2viaForbiddenLen_helper(lNum, i, 2, downVia, upVia,   true );
+  prep_via2viaForbiddenLen_helper(lNum, i, 3, downVia, upVia,   false);
+  prep_via2viaForbiddenLen_helper(lNum, i, 4, upVia,   downVia, true );
+  prep_via2viaForbiddenLen_helper(lNum, i, 5, upVia,   downVia, false);
+  prep_via2viaForbiddenLen_helper(lNum, i, 6, upVia,   upVia,   true );
+  prep_via2viaForbiddenLen_helper(lNum, i, 7, upVia,   upVia,   false);
 }
 
 // assume via is always centered at (0,0) for shapes on all three layers
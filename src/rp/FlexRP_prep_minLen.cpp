@@ -0,0 +1,766 @@
+/* Authors: Lutong Wang and Bangqi Xu */
+/*
+ * Copyright (c) 2019, The Regents of the University of California
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include "frProfileTask.h"
+#include "FlexRP.h"
+#include "db/infra/frTime.h"
+
+using namespace std;
+using namespace fr;
+
+// min length tables consumed by dr grid graph, one routing layer per call
+
+void FlexRP::prep_halfViaEncArea(const frLayerNum &lNum, const int &i, frViaDef* upVia) {
+  if (!upVia) {
+    return;
+  }
+  frVia via(upVia);
+  frBox layer1Box;
+  frBox layer2Box;
+  via.getLayer1BBox(layer1Box);
+  via.getLayer2BBox(layer2Box);
+  tech->halfViaEncArea[(i << 1) + 0] = layer1Box.width() * layer1Box.length() / 2;
+  tech->halfViaEncArea[(i << 1) + 1] = layer2Box.width() * layer2Box.length() / 2;
+}
+
+void FlexRP::prep_via2viaMinLen(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  frViaDef* viaDefs[2] = {downVia, upVia};
+  for (int isPrevViaUp = 0; isPrevViaUp < 2; isPrevViaUp++) {
+    for (int isCurrViaUp = 0; isCurrViaUp < 2; isCurrViaUp++) {
+      auto viaDef1 = viaDefs[isPrevViaUp];
+      auto viaDef2 = viaDefs[isCurrViaUp];
+      frCoord minLen = 0;
+      minLen = max(minLen, prep_via2viaMinLen_minSpc(lNum, viaDef1, viaDef2));
+      minLen = max(minLen, prep_via2viaMinLen_minimumcut1(lNum, viaDef1, viaDef2));
+      int idx = (i << 2) + (isPrevViaUp << 1) + isCurrViaUp;
+      tech->via2ViaMinLen[idx]  = minLen;
+      tech->via2ViaZeroLen[idx] = prep_via2viaMinLen_minimumcut2(lNum, viaDef1, viaDef2);
+    }
+  }
+}
+
+void FlexRP::prep_via2viaMinLenNew(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  frViaDef* viaDefs[2] = {downVia, upVia};
+  for (int isPrevViaUp = 0; isPrevViaUp < 2; isPrevViaUp++) {
+    for (int isCurrViaUp = 0; isCurrViaUp < 2; isCurrViaUp++) {
+      for (int isCurrDirY = 0; isCurrDirY < 2; isCurrDirY++) {
+        auto viaDef1 = viaDefs[isPrevViaUp];
+        auto viaDef2 = viaDefs[isCurrViaUp];
+        frCoord minLen = 0;
+        minLen = max(minLen, prep_via2viaMinLenNew_minSpc(lNum, viaDef1, viaDef2, isCurrDirY));
+        minLen = max(minLen, prep_via2viaMinLenNew_minimumcut1(lNum, viaDef1, viaDef2, isCurrDirY));
+        minLen = max(minLen, prep_via2viaMinLenNew_cutSpc(lNum, viaDef1, viaDef2, isCurrDirY));
+        tech->via2ViaMinLenNew[(i << 3) + (isPrevViaUp << 2) + (isCurrViaUp << 1) + isCurrDirY] = minLen;
+      }
+    }
+  }
+}
+
+void FlexRP::prep_via2turnMinLen(const frLayerNum &lNum, const int &i, frViaDef* downVia, frViaDef* upVia) {
+  frViaDef* viaDefs[2] = {downVia, upVia};
+  for (int isPrevViaUp = 0; isPrevViaUp < 2; isPrevViaUp++) {
+    for (int isCurrDirY = 0; isCurrDirY < 2; isCurrDirY++) {
+      auto viaDef = viaDefs[isPrevViaUp];
+      frCoord minLen = 0;
+      minLen = max(minLen, prep_via2turnMinLen_minSpc(lNum, viaDef, isCurrDirY));
+      minLen = max(minLen, prep_via2turnMinLen_minStp(lNum, viaDef, isCurrDirY));
+      tech->via2TurnMinLen[(i << 2) + (isPrevViaUp << 1) + isCurrDirY] = minLen;
+    }
+  }
+}
+
+void FlexRP::prep_minLen_print() {
+  for (int i = 0; i < (int)routingLayerNums.size(); i++) {
+    auto layerName = tech->getLayer(routingLayerNums[i])->getName();
+    cout <<"initVia2ViaMinLen " <<layerName <<" (d2d, d2u, u2d, u2u) = (";
+    for (int j = 0; j < 4; j++) {
+      cout <<tech->via2ViaMinLen[(i << 2) + j] <<(j == 3 ? ")" : ", ");
+    }
+    cout <<" zerolen = (";
+    for (int j = 0; j < 4; j++) {
+      cout <<(bool)tech->via2ViaZeroLen[(i << 2) + j] <<(j == 3 ? ")" : ", ");
+    }
+    cout <<endl;
+    cout <<"initVia2ViaMinLenNew " <<layerName
+         <<" (d2d-x, d2d-y, d2u-x, d2u-y, u2d-x, u2d-y, u2u-x, u2u-y) = (";
+    for (int j = 0; j < 8; j++) {
+      cout <<tech->via2ViaMinLenNew[(i << 3) + j] <<(j == 7 ? ")" : ", ");
+    }
+    cout <<endl;
+  }
+}
+
+frCoord FlexRP::prep_via2viaMinLen_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2) {
+  if (!(viaDef1 && viaDef2)) {
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  bool isH = (getDesign()->getTech()->getLayer(lNum)->getDir() == frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
+
+  bool isVia1Above = false;
+  frVia via1(viaDef1);
+  frBox viaBox1, cutBox1;
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+    isVia1Above = true;
+  } else {
+    via1.getLayer2BBox(viaBox1);
+    isVia1Above = false;
+  }
+  via1.getCutBBox(cutBox1);
+  auto width1    = viaBox1.width();
+  auto length1   = viaBox1.length();
+
+  bool isVia2Above = false;
+  frVia via2(viaDef2);
+  frBox viaBox2, cutBox2;
+  if (viaDef2->getLayer1Num() == lNum) {
+    via2.getLayer1BBox(viaBox2);
+    isVia2Above = true;
+  } else {
+    via2.getLayer2BBox(viaBox2);
+    isVia2Above = false;
+  }
+  via2.getCutBBox(cutBox2);
+  auto width2    = viaBox2.width();
+  auto length2   = viaBox2.length();
+
+  for (auto &con: getDesign()->getTech()->getLayer(lNum)->getMinimumcutConstraints()) {
+    if ((!con->hasLength() || (con->hasLength() && length1 > con->getLength())) && 
+        width1 > con->getWidth()) {
+      bool checkVia2 = false;
+      if (!con->hasConnection()) {
+        checkVia2 = true;
+      } else {
+        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia2Above) {
+          checkVia2 = true;
+        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia2Above) {
+          checkVia2 = true;
+        }
+      }
+      if (!checkVia2) {
+        continue;
+      }
+      if (isH) {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox2.right() - 0 + 0 - viaBox1.left(), 
+                           viaBox1.right() - 0 + 0 - cutBox2.left()));
+      } else {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox2.top() - 0 + 0 - viaBox1.bottom(), 
+                           viaBox1.top() - 0 + 0 - cutBox2.bottom()));
+      }
+    } 
+    // check via1cut to via2metal
+    if ((!con->hasLength() || (con->hasLength() && length2 > con->getLength())) && 
+        width2 > con->getWidth()) {
+      bool checkVia1 = false;
+      if (!con->hasConnection()) {
+        checkVia1 = true;
+      } else {
+        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia1Above) {
+          checkVia1 = true;
+        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia1Above) {
+          checkVia1 = true;
+        }
+      }
+      if (!checkVia1) {
+        continue;
+      }
+      if (isH) {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox1.right() - 0 + 0 - viaBox2.left(), 
+                           viaBox2.right() - 0 + 0 - cutBox1.left()));
+      } else {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox1.top() - 0 + 0 - viaBox2.bottom(), 
+                           viaBox2.top() - 0 + 0 - cutBox1.bottom()));
+      }
+    }
+  }
+
+  return sol;
+}
+
+bool FlexRP::prep_via2viaMinLen_minimumcut2(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2) {
+  if (!(viaDef1 && viaDef2)) {
+    return true;
+  }
+  // skip if same-layer via
+  if (viaDef1 == viaDef2) {
+    return true;
+  }
+
+  bool sol = true;
+
+  bool isVia1Above = false;
+  frVia via1(viaDef1);
+  frBox viaBox1, cutBox1;
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+    isVia1Above = true;
+  } else {
+    via1.getLayer2BBox(viaBox1);
+    isVia1Above = false;
+  }
+  via1.getCutBBox(cutBox1);
+  auto width1    = viaBox1.width();
+
+  bool isVia2Above = false;
+  frVia via2(viaDef2);
+  frBox viaBox2, cutBox2;
+  if (viaDef2->getLayer1Num() == lNum) {
+    via2.getLayer1BBox(viaBox2);
+    isVia2Above = true;
+  } else {
+    via2.getLayer2BBox(viaBox2);
+    isVia2Above = false;
+  }
+  via2.getCutBBox(cutBox2);
+  auto width2    = viaBox2.width();
+
+  for (auto &con: getDesign()->getTech()->getLayer(lNum)->getMinimumcutConstraints()) {
+    if (con->hasLength()) {
+      continue;
+    }
+    // check via2cut to via1metal
+    if (width1 > con->getWidth()) {
+      bool checkVia2 = false;
+      if (!con->hasConnection()) {
+        checkVia2 = true;
+      } else {
+        // has length rule
+        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia2Above) {
+          checkVia2 = true;
+        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia2Above) {
+          checkVia2 = true;
+        }
+      }
+      if (!checkVia2) {
+        continue;
+      }
+      sol = false;
+      break;
+    } 
+    // check via1cut to via2metal
+    if (width2 > con->getWidth()) {
+      bool checkVia1 = false;
+      if (!con->hasConnection()) {
+        checkVia1 = true;
+      } else {
+        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia1Above) {
+          checkVia1 = true;
+        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia1Above) {
+          checkVia1 = true;
+        }
+      }
+      if (!checkVia1) {
+        continue;
+      }
+      sol = false;
+      break;
+    }
+  }
+  return sol;
+}
+
+frCoord FlexRP::prep_via2viaMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2) {
+  if (!(viaDef1 && viaDef2)) {
+    //cout <<"hehehehehe" <<endl;
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  bool isH = (getDesign()->getTech()->getLayer(lNum)->getDir() == frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
+  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
+
+  frVia via1(viaDef1);
+  frBox viaBox1;
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+  } else {
+    via1.getLayer2BBox(viaBox1);
+  }
+  auto width1    = viaBox1.width();
+  bool isVia1Fat = isH ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
+  auto prl1      = isH ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
+
+  frVia via2(viaDef2);
+  frBox viaBox2;
+  if (viaDef2->getLayer1Num() == lNum) {
+    via2.getLayer1BBox(viaBox2);
+  } else {
+    via2.getLayer2BBox(viaBox2);
+  }
+  auto width2    = viaBox2.width();
+  bool isVia2Fat = isH ? (viaBox2.top() - viaBox2.bottom() > defaultWidth) : (viaBox2.right() - viaBox2.left() > defaultWidth);
+  auto prl2      = isH ? (viaBox2.top() - viaBox2.bottom()) : (viaBox2.right() - viaBox2.left());
+
+  frCoord reqDist = 0;
+  if (isVia1Fat && isVia2Fat) {
+    auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
+    if (con) {
+      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
+        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
+      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), min(prl1, prl2));
+      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
+        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, min(prl1, prl2));
+      }
+    }
+    if (isH) {
+      reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
+      reqDist += max((viaBox2.right() - 0), (0 - viaBox2.left()));
+    } else {
+      reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
+      reqDist += max((viaBox2.top() - 0), (0 - viaBox2.bottom()));
+    }
+    sol = max(sol, reqDist);
+  }
+
+  // check min len in layer2 if two vias are in same layer
+  if (viaDef1 != viaDef2) {
+    return sol;
+  }
+
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer2BBox(viaBox1);
+    lNum = lNum + 2;
+  } else {
+    via1.getLayer1BBox(viaBox1);
+    lNum = lNum - 2;
+  }
+  width1    = viaBox1.width();
+  prl1      = isH ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
+  reqDist   = 0;
+  auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
+  if (con) {
+    if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
+      reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
+    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+      reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), prl1);
+    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
+      reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, prl1);
+    }
+  }
+  if (isH) {
+    reqDist += (viaBox1.right() - 0) + (0 - viaBox1.left());
+  } else {
+    reqDist += (viaBox1.top() - 0) + (0 - viaBox1.bottom());
+  }
+  sol = max(sol, reqDist);
+  
+  return sol;
+}
+
+frCoord FlexRP::prep_via2viaMinLenNew_minimumcut1(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY) {
+  if (!(viaDef1 && viaDef2)) {
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  bool isCurrDirX = !isCurrDirY;
+
+  bool isVia1Above = false;
+  frVia via1(viaDef1);
+  frBox viaBox1, cutBox1;
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+    isVia1Above = true;
+  } else {
+    via1.getLayer2BBox(viaBox1);
+    isVia1Above = false;
+  }
+  via1.getCutBBox(cutBox1);
+  auto width1    = viaBox1.width();
+  auto length1   = viaBox1.length();
+
+  bool isVia2Above = false;
+  frVia via2(viaDef2);
+  frBox viaBox2, cutBox2;
+  if (viaDef2->getLayer1Num() == lNum) {
+    via2.getLayer1BBox(viaBox2);
+    isVia2Above = true;
+  } else {
+    via2.getLayer2BBox(viaBox2);
+    isVia2Above = false;
+  }
+  via2.getCutBBox(cutBox2);
+  auto width2    = viaBox2.width();
+  auto length2   = viaBox2.length();
+
+  for (auto &con: getDesign()->getTech()->getLayer(lNum)->getMinimumcutConstraints()) {
+    // check via2cut to via1metal
+    // no length OR metal1 shape satisfies --> check via2
+    if ((!con->hasLength() || (con->hasLength() && length1 > con->getLength())) && 
+        width1 > con->getWidth()) {
+      bool checkVia2 = false;
+      if (!con->hasConnection()) {
+        checkVia2 = true;
+      } else {
+        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia2Above) {
+          checkVia2 = true;
+        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia2Above) {
+          checkVia2 = true;
+        }
+      }
+      if (!checkVia2) {
+        continue;
+      }
+      if (isCurrDirX) {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox2.right() - 0 + 0 - viaBox1.left(), 
+                           viaBox1.right() - 0 + 0 - cutBox2.left()));
+      } else {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox2.top() - 0 + 0 - viaBox1.bottom(), 
+                           viaBox1.top() - 0 + 0 - cutBox2.bottom()));
+      }
+    } 
+    // check via1cut to via2metal
+    if ((!con->hasLength() || (con->hasLength() && length2 > con->getLength())) && 
+        width2 > con->getWidth()) {
+      bool checkVia1 = false;
+      if (!con->hasConnection()) {
+        checkVia1 = true;
+      } else {
+        if (con->getConnection() == frMinimumcutConnectionEnum::FROMABOVE && isVia1Above) {
+          checkVia1 = true;
+        } else if (con->getConnection() == frMinimumcutConnectionEnum::FROMBELOW && !isVia1Above) {
+          checkVia1 = true;
+        }
+      }
+      if (!checkVia1) {
+        continue;
+      }
+      if (isCurrDirX) {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox1.right() - 0 + 0 - viaBox2.left(), 
+                           viaBox2.right() - 0 + 0 - cutBox1.left()));
+      } else {
+        sol = max(sol, (con->hasLength() ? con->getDistance() : 0) + 
+                       max(cutBox1.top() - 0 + 0 - viaBox2.bottom(), 
+                           viaBox2.top() - 0 + 0 - cutBox1.bottom()));
+      }
+    }
+  }
+
+  return sol;
+}
+
+frCoord FlexRP::prep_via2viaMinLenNew_minSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY) {
+  if (!(viaDef1 && viaDef2)) {
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  bool isCurrDirX = !isCurrDirY;
+  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
+
+  frVia via1(viaDef1);
+  frBox viaBox1;
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+  } else {
+    via1.getLayer2BBox(viaBox1);
+  }
+  auto width1    = viaBox1.width();
+  bool isVia1Fat = isCurrDirX ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
+  auto prl1      = isCurrDirX ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
+
+  frVia via2(viaDef2);
+  frBox viaBox2;
+  if (viaDef2->getLayer1Num() == lNum) {
+    via2.getLayer1BBox(viaBox2);
+  } else {
+    via2.getLayer2BBox(viaBox2);
+  }
+  auto width2    = viaBox2.width();
+  bool isVia2Fat = isCurrDirX ? (viaBox2.top() - viaBox2.bottom() > defaultWidth) : (viaBox2.right() - viaBox2.left() > defaultWidth);
+  auto prl2      = isCurrDirX ? (viaBox2.top() - viaBox2.bottom()) : (viaBox2.right() - viaBox2.left());
+
+  frCoord reqDist = 0;
+  if (isVia1Fat && isVia2Fat) {
+    auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
+    if (con) {
+      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
+        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
+      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), min(prl1, prl2));
+      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
+        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, min(prl1, prl2));
+      }
+    }
+    if (isCurrDirX) {
+      reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
+      reqDist += max((viaBox2.right() - 0), (0 - viaBox2.left()));
+    } else {
+      reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
+      reqDist += max((viaBox2.top() - 0), (0 - viaBox2.bottom()));
+    }
+    sol = max(sol, reqDist);
+  }
+
+  // check min len in layer2 if two vias are in same layer
+  if (viaDef1 != viaDef2) {
+    return sol;
+  }
+
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer2BBox(viaBox1);
+    lNum = lNum + 2;
+  } else {
+    via1.getLayer1BBox(viaBox1);
+    lNum = lNum - 2;
+  }
+  width1    = viaBox1.width();
+  prl1      = isCurrDirX ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
+  reqDist   = 0;
+  auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
+  if (con) {
+    if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
+      reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
+    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+      reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, width2), prl1);
+    } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
+      reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, width2, prl1);
+    }
+  }
+  if (isCurrDirX) {
+    reqDist += (viaBox1.right() - 0) + (0 - viaBox1.left());
+  } else {
+    reqDist += (viaBox1.top() - 0) + (0 - viaBox1.bottom());
+  }
+  sol = max(sol, reqDist);
+  
+  return sol;
+}
+
+frCoord FlexRP::prep_via2viaMinLenNew_cutSpc(frLayerNum lNum, frViaDef* viaDef1, frViaDef* viaDef2, bool isCurrDirY) {
+  if (!(viaDef1 && viaDef2)) {
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  frVia via1(viaDef1);
+  frBox viaBox1, cutBox1;
+  if (viaDef1->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+  } else {
+    via1.getLayer2BBox(viaBox1);
+  }
+  via1.getCutBBox(cutBox1);
+
+  frVia via2(viaDef2);
+  frBox viaBox2, cutBox2;
+  if (viaDef2->getLayer1Num() == lNum) {
+    via2.getLayer1BBox(viaBox2);
+  } else {
+    via2.getLayer2BBox(viaBox2);
+  }
+  via2.getCutBBox(cutBox2);
+
+  // same layer (use samenet rule if exist, otherwise use diffnet rule)
+  if (viaDef1->getCutLayerNum() == viaDef2->getCutLayerNum()) {
+    auto samenetCons = getDesign()->getTech()->getLayer(viaDef1->getCutLayerNum())->getCutSpacing(true);
+    auto diffnetCons = getDesign()->getTech()->getLayer(viaDef1->getCutLayerNum())->getCutSpacing(false);
+    if (!samenetCons.empty()) {
+      // check samenet spacing rule if exists
+      for (auto con: samenetCons) {
+        if (con == nullptr) {
+          continue;
+        }
+        // filter rule, assuming default via will never trigger cutArea
+        if (con->hasSecondLayer() || con->isAdjacentCuts() || con->isParallelOverlap() || con->isArea() || !con->hasSameNet()) {
+          continue;
+        }
+        auto reqSpcVal = con->getCutSpacing();
+        if (!con->hasCenterToCenter()) {
+          reqSpcVal += isCurrDirY ? (cutBox1.top() - cutBox1.bottom()) : (cutBox1.right() - cutBox1.left());
+        }
+        sol = max(sol, reqSpcVal);
+      }
+    } else {
+      // check diffnet spacing rule
+      // filter rule, assuming default via will never trigger cutArea
+      for (auto con: diffnetCons) {
+        if (con == nullptr) {
+          continue;
+        }
+        if (con->hasSecondLayer() || con->isAdjacentCuts() || con->isParallelOverlap() || con->isArea() || con->hasSameNet()) {
+          continue;
+        }
+        auto reqSpcVal = con->getCutSpacing();
+        if (!con->hasCenterToCenter()) {
+          reqSpcVal += isCurrDirY ? (cutBox1.top() - cutBox1.bottom()) : (cutBox1.right() - cutBox1.left());
+        }
+        sol = max(sol, reqSpcVal);
+      }
+    }
+  // TODO: diff layer 
+  } else {
+    auto layerNum1 = viaDef1->getCutLayerNum();
+    auto layerNum2 = viaDef2->getCutLayerNum();
+    frCutSpacingConstraint* samenetCon = nullptr;
+    if (getDesign()->getTech()->getLayer(layerNum1)->hasInterLayerCutSpacing(layerNum2, true)) {
+      samenetCon = getDesign()->getTech()->getLayer(layerNum1)->getInterLayerCutSpacing(layerNum2, true);
+    }
+    if (getDesign()->getTech()->getLayer(layerNum2)->hasInterLayerCutSpacing(layerNum1, true)) {
+      if (samenetCon) {
+        cout <<"Warning: duplicate diff layer samenet cut spacing, skipping cut spacing from " 
+             <<layerNum2 <<" to " <<layerNum1 <<endl;
+      } else {
+        samenetCon = getDesign()->getTech()->getLayer(layerNum2)->getInterLayerCutSpacing(layerNum1, true);
+      }
+    }
+    if (samenetCon == nullptr) {
+      if (getDesign()->getTech()->getLayer(layerNum1)->hasInterLayerCutSpacing(layerNum2, false)) {
+        samenetCon = getDesign()->getTech()->getLayer(layerNum1)->getInterLayerCutSpacing(layerNum2, false);
+      }
+      if (getDesign()->getTech()->getLayer(layerNum2)->hasInterLayerCutSpacing(layerNum1, false)) {
+        if (samenetCon) {
+          cout <<"Warning: duplicate diff layer diffnet cut spacing, skipping cut spacing from " 
+               <<layerNum2 <<" to " <<layerNum1 <<endl;
+        } else {
+          samenetCon = getDesign()->getTech()->getLayer(layerNum2)->getInterLayerCutSpacing(layerNum1, false);
+        }
+      }
+    }
+    if (samenetCon) {
+      // filter rule, assuming default via will never trigger cutArea
+      auto reqSpcVal = samenetCon->getCutSpacing();
+      if (reqSpcVal == 0) {
+        ;
+      } else {
+        if (!samenetCon->hasCenterToCenter()) {
+          reqSpcVal += isCurrDirY ? (cutBox1.top() - cutBox1.bottom()) : (cutBox1.right() - cutBox1.left());
+        }
+      }
+      sol = max(sol, reqSpcVal);
+    }
+  }
+
+  return sol;
+}
+
+frCoord FlexRP::prep_via2turnMinLen_minSpc(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY) {
+  if (!viaDef) {
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  bool isCurrDirX = !isCurrDirY;
+  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
+
+  frVia via1(viaDef);
+  frBox viaBox1;
+  if (viaDef->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+  } else {
+    via1.getLayer2BBox(viaBox1);
+  }
+  auto width1    = viaBox1.width();
+  bool isVia1Fat = isCurrDirX ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
+  auto prl1      = isCurrDirX ? (viaBox1.top() - viaBox1.bottom()) : (viaBox1.right() - viaBox1.left());
+
+  frCoord reqDist = 0;
+  if (isVia1Fat) {
+    auto con = getDesign()->getTech()->getLayer(lNum)->getMinSpacing();
+    if (con) {
+      if (con->typeId() == frConstraintTypeEnum::frcSpacingConstraint) {
+        reqDist = static_cast<frSpacingConstraint*>(con)->getMinSpacing();
+      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+        reqDist = static_cast<frSpacingTablePrlConstraint*>(con)->find(max(width1, defaultWidth), prl1);
+      } else if (con->typeId() == frConstraintTypeEnum::frcSpacingTableTwConstraint) {
+        reqDist = static_cast<frSpacingTableTwConstraint*>(con)->find(width1, defaultWidth, prl1);
+      }
+    }
+    if (isCurrDirX) {
+      reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
+      reqDist += defaultWidth;
+    } else {
+      reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
+      reqDist += defaultWidth;
+    }
+    sol = max(sol, reqDist);
+  }
+
+  return sol;
+}
+
+frCoord FlexRP::prep_via2turnMinLen_minStp(frLayerNum lNum, frViaDef* viaDef, bool isCurrDirY) {
+  if (!viaDef) {
+    return 0;
+  }
+
+  frCoord sol = 0;
+
+  // check min len in lNum assuming pre dir routing
+  bool isCurrDirX = !isCurrDirY;
+  frCoord defaultWidth = getDesign()->getTech()->getLayer(lNum)->getWidth();
+
+  frVia via1(viaDef);
+  frBox viaBox1;
+  if (viaDef->getLayer1Num() == lNum) {
+    via1.getLayer1BBox(viaBox1);
+  } else {
+    via1.getLayer2BBox(viaBox1);
+  }
+  bool isVia1Fat = isCurrDirX ? (viaBox1.top() - viaBox1.bottom() > defaultWidth) : (viaBox1.right() - viaBox1.left() > defaultWidth);
+
+  frCoord reqDist = 0;
+  if (isVia1Fat) {
+    auto con = getDesign()->getTech()->getLayer(lNum)->getMinStepConstraint();
+    if (con && con->hasMaxEdges()) { // currently only consider maxedge violation
+      reqDist = con->getMinStepLength();
+      if (isCurrDirX) {
+        reqDist += max((viaBox1.right() - 0), (0 - viaBox1.left()));
+        reqDist += defaultWidth;
+      } else {
+        reqDist += max((viaBox1.top() - 0), (0 - viaBox1.bottom()));
+        reqDist += defaultWidth;
+      }
+      sol = max(sol, reqDist);
+    }
+  }
+  return sol;
+}
@@ -32,6 +32,7 @@
 #include "global.h"
 #include "FlexTA.h"
 #include "db/infra/frTime.h"
+#include "db/infra/frMetrics.h"
 #include "frProfileTask.h"
 #include <algorithm>
 #include <omp.h>
@@ -130,7 +131,8 @@ int FlexTA::initTA_helper(int iter, int size, int offset, bool isH, int &numPane
   auto &ygp = gCellPatterns.at(1);
   int sol = 0;
   numPanels = 0;
-  if (MAX_THREADS == 1) {
+  // a sequential worker sees the panels assigned before it, batched workers do not
+  if (MAX_THREADS == 1 && !DETERMINISTIC) {
     if (isH) {
       for (int i = offset; i < (int)ygp.getCount(); i += size) {
         FlexTAWorker worker(getDesign());
@@ -145,6 +147,7 @@ int FlexTA::initTA_helper(int iter, int size, int offset, bool isH, int &numPane
         worker.setExtBox(extBox);
         worker.setDir(frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
         worker.setTAIter(iter);
+        worker.setEcoNets(ecoNets.empty() ? nullptr : &ecoNets);
         worker.main();
         sol += worker.getNumAssigned();
         numPanels++;
@@ -166,6 +169,7 @@ int FlexTA::initTA_helper(int iter, int size, int offset, bool isH, int &numPane
         worker.setExtBox(extBox);
         worker.setDir(frPrefRoutingDirEnum::frcVertPrefRoutingDir);
         worker.setTAIter(iter);
+        worker.setEcoNets(ecoNets.empty() ? nullptr : &ecoNets);
         worker.main();
         sol += worker.getNumAssigned();
         numPanels++;
@@ -191,6 +195,7 @@ int FlexTA::initTA_helper(int iter, int size, int offset, bool isH, int &numPane
         worker.setExtBox(extBox);
         worker.setDir(frPrefRoutingDirEnum::frcHorzPrefRoutingDir);
         worker.setTAIter(iter);
+        worker.setEcoNets(ecoNets.empty() ? nullptr : &ecoNets);
         if (workers.empty() || (int)workers.back().size() >= BATCHSIZETA) {
           workers.push_back(vector<unique_ptr<FlexTAWorker> >());
         }
@@ -211,6 +216,7 @@ int FlexTA::initTA_helper(int iter, int size, int offset, bool isH, int &numPane
         worker.setExtBox(extBox);
         worker.setDir(frPrefRoutingDirEnum::frcVertPrefRoutingDir);
         worker.setTAIter(iter);
+        worker.setEcoNets(ecoNets.empty() ? nullptr : &ecoNets);
         if (workers.empty() || (int)workers.back().size() >= BATCHSIZETA) {
           workers.push_back(vector<unique_ptr<FlexTAWorker> >());
         }
@@ -244,6 +250,7 @@ int FlexTA::initTA_helper(int iter, int size, int offset, bool isH, int &numPane
 
 void FlexTA::initTA(int size) {
   ProfileTask profile("TA:init");
+  frMetrics metrics("ta_iter", 0);
   frTime t;
 
   if (VERBOSE > 1) {
@@ -260,32 +267,39 @@ void FlexTA::initTA(int size) {
 
   int numAssigned = 0;
   int numPanels = 0;
+  int numWorkers = 0;
 
   // H first
   if (isBottomLayerH) {
     numAssigned = initTA_helper(0, size, 0, true, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<"Done with " <<numAssigned <<" horizontal wires in " <<numPanels <<" frboxes and ";
     }
     numAssigned = initTA_helper(0, size, 0, false, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<numAssigned <<" vertical wires in " <<numPanels <<" frboxes." <<endl;
     }
   // V first
   } else {
     numAssigned = initTA_helper(0, size, 0, false, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<"Done with " <<numAssigned <<" vertical wires in " <<numPanels <<" frboxes and ";
     }
     numAssigned = initTA_helper(0, size, 0, true, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<numAssigned <<" horizontal wires in " <<numPanels <<" frboxes." <<endl;
     }
   }
+  metrics.add("workers", numWorkers);
 }
 
 void FlexTA::searchRepair(int iter, int size, int offset) {
   ProfileTask profile("TA:searchRepair");
+  frMetrics metrics("ta_iter", iter);
   frTime t;
 
   if (VERBOSE > 1) {
@@ -317,27 +331,33 @@ void FlexTA::searchRepair(int iter, int size, int offset) {
   //int sol = 0;
   int numAssigned = 0;
   int numPanels = 0;
+  int numWorkers = 0;
   // H first
   if (isBottomLayerH) {
     numAssigned = initTA_helper(iter, size, offset, true, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<"Done with " <<numAssigned <<" horizontal wires in " <<numPanels <<" frboxes and ";
     }
     numAssigned = initTA_helper(iter, size, offset, false, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<numAssigned <<" vertical wires in " <<numPanels <<" frboxes." <<endl;
     }
   // V first
   } else {
     numAssigned = initTA_helper(iter, size, offset, false, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<"Done with " <<numAssigned <<" vertical wires in " <<numPanels <<" frboxes and ";
     }
     numAssigned = initTA_helper(iter, size, offset, true, numPanels);
+    numWorkers += numPanels;
     if (VERBOSE > 0) {
       cout <<numAssigned <<" horizontal wires in " <<numPanels <<" frboxes." <<endl;
     }
   }
+  metrics.add("workers", numWorkers);
 }
 
 int FlexTA::main() {
@@ -47,11 +47,16 @@ namespace fr {
     frDesign* getDesign() const {
       return design;
     }
+    // only the guides of these nets are assigned, an empty set assigns all
+    void setEcoNets(const std::set<frNet*, frBlockObjectComp> &in) {
+      ecoNets = in;
+    }
     // others
     int main();
   protected:
     frTechObject*   tech;
     frDesign*       design;
+    std::set<frNet*, frBlockObjectComp> ecoNets;
     // others
     void main_helper(frLayerNum lNum, int maxOffsetIter, int panelWidth);
     void initTA(int size);
@@ -87,7 +92,7 @@ namespace fr {
     // constructors
     FlexTAWorker(frDesign* designIn): tech(nullptr), design(designIn),
                                       dir(frPrefRoutingDirEnum::frcNotApplicablePrefRoutingDir), taIter(0),
-                                      rq(this), numAssigned(0), totCost(0), maxRetry(1) {};
+                                      rq(this), ecoNets(nullptr), numAssigned(0), totCost(0), maxRetry(1) {};
     // setters
     void setRouteBox(const frBox &boxIn) {
       routeBox.set(boxIn);
@@ -101,6 +106,9 @@ namespace fr {
     void setTAIter(int in) {
       taIter = in;
     }
+    void setEcoNets(const std::set<frNet*, frBlockObjectComp>* in) {
+      ecoNets = in;
+    }
     void addIroute(std::unique_ptr<taPin> in, bool isExt = false) {
       in->setId(iroutes.size() + extIroutes.size());
       if (isExt) {
@@ -179,6 +187,7 @@ namespace fr {
     frPrefRoutingDirEnum               dir;
     int                                taIter;
     FlexTAWorkerRegionQuery            rq;
+    const std::set<frNet*, frBlockObjectComp>* ecoNets;
 
     std::vector<std::unique_ptr<taPin> > iroutes; // unsorterd iroutes
     std::vector<std::unique_ptr<taPin> > extIroutes;
@@ -391,7 +391,9 @@ void FlexTAWorker::initIroute(frGuide *guide) {
   frBox guideBox;
   guide->getBBox(guideBox);
   auto layerNum = guide->getBeginLayerNum();
-  bool isExt = !(getRouteBox().contains(guideBox));
+  // incremental runs keep the tracks of the nets that did not change
+  bool isExt = !(getRouteBox().contains(guideBox)) || 
+               (ecoNets && ecoNets->find(guide->getNet()) == ecoNets->end());
   if (isExt) {
     // extIroute empty, skip
     if (guide->getRoutes().empty()) {
@@ -0,0 +1,84 @@
+#!/bin/bash
+
+###################################################################################
+## Authors: Lutong Wang and Bangqi Xu */
+##
+## Copyright (c) 2019, The Regents of the University of California
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##     * Redistributions of source code must retain the above copyright
+##       notice, this list of conditions and the following disclaimer.
+##     * Redistributions in binary form must reproduce the above copyright
+##       notice, this list of conditions and the following disclaimer in the
+##       documentation and/or other materials provided with the distribution.
+##     * Neither the name of the University nor the
+##       names of its contributors may be used to endorse or promote products
+##       derived from this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+## ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+## WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+## DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+## DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+## (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+## LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+## ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+## SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+###################################################################################
+
+# Routes a design with deterministic:1 once per thread count and checks
+# that all output DEFs are identical. -i sets the last DR iteration, from
+# iteration 3 on the passes are driven by the markers of the previous one.
+
+end_iter=1
+if [ "$1" == "-i" ]; then
+  end_iter=$2
+  shift 2
+fi
+
+if [ "$#" -lt 4 ]; then
+  echo "Usage: ./determinismTest.sh [-i <end_iter>] <path_to_bin> <design_dir> <work_dir> <threads> [<threads> ...]"
+  echo "       (e.g., ./determinismTest.sh -i 4 ../build/TritonRoute ../ispd18_test1 /tmp/det 1 8)"
+  exit 1
+fi
+
+binary=$(readlink -f $1)
+design_dir=$(readlink -f $2)
+work_dir=$3
+design=$(basename $design_dir)
+shift 3
+
+if [ ! -e $binary ] ;
+then
+  echo "    - Binary not found. Exiting..."
+  exit 1
+fi
+
+source $(dirname $0)/routeTestLib.sh
+
+ref_def=""
+for threads in "$@" ;
+do
+  run_dir=$work_dir/threads_$threads
+  write_param $run_dir $threads
+  echo " > Routing $design with $threads threads..."
+  if ! run $run_dir || [ ! -e $run_dir/out.def ] ;
+  then
+    echo "     - Run failed, see $run_dir/run.log"
+    exit 1
+  fi
+  if [ -z "$ref_def" ] ;
+  then
+    ref_def=$run_dir/out.def
+  elif ! cmp -s $ref_def $run_dir/out.def ;
+  then
+    echo "     - $run_dir/out.def differs from $ref_def"
+    exit 1
+  fi
+done
+
+echo "     - All output DEFs are identical"
+exit 0
@@ -0,0 +1,95 @@
+#!/bin/bash
+
+###################################################################################
+## Authors: Lutong Wang and Bangqi Xu */
+##
+## Copyright (c) 2019, The Regents of the University of California
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##     * Redistributions of source code must retain the above copyright
+##       notice, this list of conditions and the following disclaimer.
+##     * Redistributions in binary form must reproduce the above copyright
+##       notice, this list of conditions and the following disclaimer in the
+##       documentation and/or other materials provided with the distribution.
+##     * Neither the name of the University nor the
+##       names of its contributors may be used to endorse or promote products
+##       derived from this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+## ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+## WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+## DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+## DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+## (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+## LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+## ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+## SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+###################################################################################
+
+
+# Routes a design in one process and again with a distributed DR leader and
+# <num_workers> worker processes on this machine, then checks that both
+# output DEFs are identical. The address defaults to a unix socket in
+# <work_dir>; pass e.g. localhost:7460 to use TCP loopback instead.
+
+if [ "$#" -lt 4 ]; then
+  echo "Usage: ./distTest.sh <path_to_bin> <design_dir> <work_dir> <num_workers> [<address>]"
+  echo "       (e.g., ./distTest.sh ../build/TritonRoute ../ispd18_test1 /tmp/dist 2)"
+  exit 1
+fi
+
+binary=$(readlink -f $1)
+design_dir=$(readlink -f $2)
+mkdir -p $3
+work_dir=$(readlink -f $3)
+num_workers=$4
+address=${5:-unix:$work_dir/dist.sock}
+design=$(basename $design_dir)
+
+if [ ! -e $binary ] ;
+then
+  echo "    - Binary not found. Exiting..."
+  exit 1
+fi
+
+source $(dirname $0)/routeTestLib.sh
+
+write_param $work_dir/single 1
+echo " > Routing $design in one process..."
+if ! run $work_dir/single ;
+then
+  echo "     - Run failed, see $work_dir/single/run.log"
+  exit 1
+fi
+
+write_param $work_dir/leader 1 drouteDistListen:$address drouteDistWorkers:$num_workers
+echo " > Routing $design with $num_workers worker processes on $address..."
+pids=""
+for i in $(seq 1 $num_workers) ;
+do
+  write_param $work_dir/worker_$i 2
+  run $work_dir/worker_$i -dist_leader $address &
+  pids="$pids $!"
+done
+status=0
+run $work_dir/leader || status=1
+for pid in $pids ;
+do
+  wait $pid || status=1
+done
+if [ $status -ne 0 ] || [ ! -e $work_dir/leader/out.def ] ;
+then
+  echo "     - Run failed, see the run.log files in $work_dir"
+  exit 1
+fi
+
+if ! cmp -s $work_dir/single/out.def $work_dir/leader/out.def ;
+then
+  echo "     - $work_dir/leader/out.def differs from $work_dir/single/out.def"
+  exit 1
+fi
+echo "     - Output DEFs are identical"
+exit 0
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAS_BOOST_UNIT_TEST_LIBRARY
+// Shared library version
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "FlexRoute.h"
+#include "frDesign.h"
+#include "global.h"
+#include "io/io.h"
+
+using namespace fr;
+
+namespace {
+
+using RouteKey = std::vector<std::tuple<int, int, int, int, int>>;
+
+// layer and box of every shape and via of a net
+RouteKey getRouteKey(const frNet* net)
+{
+  RouteKey key;
+  frBox box;
+  for (auto& shape : net->getShapes()) {
+    shape->getBBox(box);
+    key.emplace_back(
+        shape->getLayerNum(), box.left(), box.bottom(), box.right(), box.top());
+  }
+  for (auto& via : net->getVias()) {
+    via->getBBox(box);
+    key.emplace_back(-1, box.left(), box.bottom(), box.right(), box.top());
+  }
+  return key;
+}
+
+std::map<std::string, RouteKey> getRouteKeys(const frBlock* block)
+{
+  std::map<std::string, RouteKey> routes;
+  for (auto& net : block->getNets()) {
+    routes[net->getName()] = getRouteKey(net.get());
+  }
+  return routes;
+}
+
+// every net except ecoNet kept its route
+void checkOtherRoutes(const frBlock* block,
+                      const frNet* ecoNet,
+                      std::map<std::string, RouteKey>& routes)
+{
+  for (auto& net : block->getNets()) {
+    if (net.get() != ecoNet) {
+      BOOST_TEST((routes[net->getName()] == getRouteKey(net.get())),
+                 net->getName());
+    }
+  }
+}
+
+// Hand the parsed sample design over in memory and route it stage by stage.
+std::unique_ptr<FlexRoute> routeSample(
+    std::map<frNet*, std::vector<frRect>, frBlockObjectComp>& guides)
+{
+  const std::string dir = std::string(TEST_TESTCASE_DIR) + "/ispd18_sample/";
+  LEF_FILE = dir + "ispd18_sample.input.lef";
+  DEF_FILE = dir + "ispd18_sample.input.def";
+  GUIDE_FILE = dir + "ispd18_sample.input.guide";
+  VERBOSE = 0;
+
+  auto design = std::make_unique<frDesign>();
+  io::Parser parser(design.get());
+  parser.readLefDef();
+  parser.readGuide();
+  guides = parser.getGuides();
+
+  auto router = std::make_unique<FlexRoute>(std::move(design));
+  for (auto& [net, rects] : guides) {
+    router->setGuides(net, rects);
+  }
+  router->init();
+  router->prep();
+  router->ta();
+  router->dr();
+  return router;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(eco);
+
+// Change the guides of one net and check that only that net is rerouted.
+BOOST_AUTO_TEST_CASE(reroute_changed_net)
+{
+  std::map<frNet*, std::vector<frRect>, frBlockObjectComp> guides;
+  auto router = routeSample(guides);
+
+  auto block = router->getDesign()->getTopBlock();
+  auto ecoNet = block->getNet("net1230");
+  BOOST_TEST_REQUIRE(ecoNet != nullptr);
+  BOOST_TEST(!ecoNet->getShapes().empty());
+  BOOST_TEST(router->eco() == 0);
+
+  auto routes = getRouteKeys(block);
+  router->setGuides(ecoNet, guides[ecoNet]);
+  BOOST_TEST(router->eco() == 1);
+  BOOST_TEST(!ecoNet->getShapes().empty());
+  checkOtherRoutes(block, ecoNet, routes);
+  BOOST_TEST(router->eco() == 0);
+}
+
+// Disconnect an instTerm from a net without new guides, then connect it
+// again. Each time only that net is rerouted, on its original guides.
+BOOST_AUTO_TEST_CASE(reroute_changed_pins)
+{
+  std::map<frNet*, std::vector<frRect>, frBlockObjectComp> guides;
+  auto router = routeSample(guides);
+
+  auto block = router->getDesign()->getTopBlock();
+  auto ecoNet = block->getNet("net1230");
+  BOOST_TEST_REQUIRE(ecoNet != nullptr);
+  BOOST_TEST_REQUIRE(ecoNet->getInstTerms().size() == 2);
+  auto instTerm = ecoNet->getInstTerms().back();
+
+  // the sample nets have two pins, one pin alone needs no route
+  auto routes = getRouteKeys(block);
+  ecoNet->removeInstTerm(instTerm);
+  instTerm->addToNet(nullptr);
+  BOOST_TEST(router->eco() == 1);
+  BOOST_TEST(ecoNet->getShapes().empty());
+  checkOtherRoutes(block, ecoNet, routes);
+
+  routes = getRouteKeys(block);
+  ecoNet->addInstTerm(instTerm);
+  instTerm->addToNet(ecoNet);
+  BOOST_TEST(router->eco() == 1);
+  BOOST_TEST(!ecoNet->getShapes().empty());
+  checkOtherRoutes(block, ecoNet, routes);
+  BOOST_TEST(router->eco() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,98 @@
+#!/bin/bash
+
+###################################################################################
+## Authors: Lutong Wang and Bangqi Xu */
+##
+## Copyright (c) 2019, The Regents of the University of California
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##     * Redistributions of source code must retain the above copyright
+##       notice, this list of conditions and the following disclaimer.
+##     * Redistributions in binary form must reproduce the above copyright
+##       notice, this list of conditions and the following disclaimer in the
+##       documentation and/or other materials provided with the distribution.
+##     * Neither the name of the University nor the
+##       names of its contributors may be used to endorse or promote products
+##       derived from this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+## ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+## WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+## DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+## DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+## (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+## LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+## ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+## SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+###################################################################################
+
+
+# Routes a design in one process and again with a distributed DR leader and
+
+# Routes a design to DR iteration <end_iter> in one go and again in two
+# runs, the second restarting from the checkpoint the first wrote after
+# iteration <restart_iter>, then checks that both output DEFs are
+# identical. Both runs write checkpoints at the same interval, as the
+# region query is rebuilt after each one.
+
+if [ "$#" -lt 5 ]; then
+  echo "Usage: ./restartTest.sh <path_to_bin> <design_dir> <work_dir> <restart_iter> <end_iter>"
+  echo "       (e.g., ./restartTest.sh ../build/TritonRoute ../ispd18_test1 /tmp/restart 2 4)"
+  exit 1
+fi
+
+binary=$(readlink -f $1)
+design_dir=$(readlink -f $2)
+mkdir -p $3
+work_dir=$(readlink -f $3)
+restart_iter=$4
+design=$(basename $design_dir)
+
+if [ ! -e $binary ] ;
+then
+  echo "    - Binary not found. Exiting..."
+  exit 1
+fi
+
+source $(dirname $0)/routeTestLib.sh
+
+# drouteCheckpointInterval counts iterations from 1
+interval=$((restart_iter + 1))
+
+end_iter=$5
+write_param $work_dir/single 1 drouteCheckpoint:$work_dir/single/ckpt.bin drouteCheckpointInterval:$interval
+echo " > Routing $design to iteration $end_iter..."
+if ! run $work_dir/single ;
+then
+  echo "     - Run failed, see $work_dir/single/run.log"
+  exit 1
+fi
+
+end_iter=$restart_iter
+write_param $work_dir/first 1 drouteCheckpoint:$work_dir/first/ckpt.bin drouteCheckpointInterval:$interval
+echo " > Routing $design to iteration $restart_iter..."
+if ! run $work_dir/first || [ ! -e $work_dir/first/ckpt.bin ] ;
+then
+  echo "     - Run failed, see $work_dir/first/run.log"
+  exit 1
+fi
+
+end_iter=$5
+write_param $work_dir/restart 1 drouteCheckpoint:$work_dir/restart/ckpt.bin drouteCheckpointInterval:$interval
+echo " > Restarting $design from iteration $restart_iter to iteration $end_iter..."
+if ! run $work_dir/restart -restart_from $work_dir/first/ckpt.bin ;
+then
+  echo "     - Run failed, see $work_dir/restart/run.log"
+  exit 1
+fi
+
+if ! cmp -s $work_dir/single/out.def $work_dir/restart/out.def ;
+then
+  echo "     - $work_dir/restart/out.def differs from $work_dir/single/out.def"
+  exit 1
+fi
+echo "     - Output DEFs are identical"
+exit 0
@@ -0,0 +1,59 @@
+#!/bin/bash
+
+###################################################################################
+## Authors: Lutong Wang and Bangqi Xu */
+##
+## Copyright (c) 2019, The Regents of the University of California
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##     * Redistributions of source code must retain the above copyright
+##       notice, this list of conditions and the following disclaimer.
+##     * Redistributions in binary form must reproduce the above copyright
+##       notice, this list of conditions and the following disclaimer in the
+##       documentation and/or other materials provided with the distribution.
+##     * Neither the name of the University nor the
+##       names of its contributors may be used to endorse or promote products
+##       derived from this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+## ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+## WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+## DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY
+## DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+## (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+## LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+## ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+## SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+###################################################################################
+
+
+# Shared by determinismTest.sh, distTest.sh and restartTest.sh, which
+# source it after setting binary, design_dir and design, and optionally
+# end_iter (the last DR iteration, 1 by default).
+
+# write_param <run_dir> <threads> [extra lines]
+write_param() {
+  mkdir -p $1
+  cat > $1/param.txt <<EOP
+lef:$design_dir/$design.input.lef
+def:$design_dir/$design.input.def
+guide:$design_dir/$design.input.guide
+output:$1/out.def
+outputTA:$1/outTA.def
+threads:$2
+drouteEndIterNum:${end_iter:-1}
+deterministic:1
+EOP
+  for line in "${@:3}" ; do
+    echo "$line" >> $1/param.txt
+  done
+}
+
+# run <run_dir> [options], drops the timing lines of the wavefront kernels
+run() {
+  $binary $1/param.txt "${@:2}" 2>&1 | grep -v "^Time Taken By\|^$" > $1/run.log
+  return ${PIPESTATUS[0]}
+}
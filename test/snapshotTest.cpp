@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2020, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAS_BOOST_UNIT_TEST_LIBRARY
+// Shared library version
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "frDesign.h"
+#include "global.h"
+#include "io/io.h"
+
+using namespace fr;
+
+namespace {
+
+std::string readFile(const std::string& fileName)
+{
+  std::ifstream fin(fileName, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(fin),
+                     std::istreambuf_iterator<char>());
+}
+
+void checkSameBox(const frShape* a, const frShape* b)
+{
+  frBox boxA, boxB;
+  a->getBBox(boxA);
+  b->getBBox(boxB);
+  BOOST_TEST(a->getLayerNum() == b->getLayerNum());
+  BOOST_TEST(boxA.left() == boxB.left());
+  BOOST_TEST(boxA.bottom() == boxB.bottom());
+  BOOST_TEST(boxA.right() == boxB.right());
+  BOOST_TEST(boxA.top() == boxB.top());
+}
+
+// every pin of the term and every figure of each pin, with its layer
+void checkSameTerm(const frTerm* a, const frTerm* b)
+{
+  BOOST_TEST(a->getName() == b->getName());
+  BOOST_TEST(a->getId() == b->getId());
+  BOOST_TEST_REQUIRE(a->getPins().size() == b->getPins().size());
+  for (size_t i = 0; i < a->getPins().size(); i++) {
+    auto& figsA = a->getPins()[i]->getFigs();
+    auto& figsB = b->getPins()[i]->getFigs();
+    BOOST_TEST_REQUIRE(figsA.size() == figsB.size());
+    for (size_t j = 0; j < figsA.size(); j++) {
+      BOOST_TEST((figsA[j]->typeId() == figsB[j]->typeId()));
+      checkSameBox(static_cast<frShape*>(figsA[j].get()),
+                   static_cast<frShape*>(figsB[j].get()));
+    }
+  }
+}
+
+void checkSameNet(const frNet* a, const frNet* b)
+{
+  BOOST_TEST(a->getName() == b->getName());
+  BOOST_TEST(a->getId() == b->getId());
+  BOOST_TEST((a->getType() == b->getType()));
+  BOOST_TEST(a->getInstTerms().size() == b->getInstTerms().size());
+  for (size_t i = 0;
+       i < std::min(a->getInstTerms().size(), b->getInstTerms().size());
+       i++) {
+    auto instTermA = a->getInstTerms()[i];
+    auto instTermB = b->getInstTerms()[i];
+    BOOST_TEST(instTermA->getId() == instTermB->getId());
+    BOOST_TEST(instTermA->getInst()->getName()
+               == instTermB->getInst()->getName());
+    BOOST_TEST(instTermA->getTerm()->getName()
+               == instTermB->getTerm()->getName());
+    BOOST_TEST(instTermB->getNet() == b);
+  }
+  BOOST_TEST(a->getTerms().size() == b->getTerms().size());
+  BOOST_TEST(a->getShapes().size() == b->getShapes().size());
+  for (auto itA = a->getShapes().begin(), itB = b->getShapes().begin();
+       itA != a->getShapes().end() && itB != b->getShapes().end();
+       ++itA, ++itB) {
+    checkSameBox(itA->get(), itB->get());
+  }
+  BOOST_TEST(a->getVias().size() == b->getVias().size());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(snapshot);
+
+// Parse the sample design through LEF/DEF/guide, snapshot it, load the
+// snapshot into a fresh design and check both sides agree.
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  const std::string dir = std::string(TEST_TESTCASE_DIR) + "/ispd18_sample/";
+  const std::string defFile = "snapshotTest.def";
+  LEF_FILE = dir + "ispd18_sample.input.lef";
+  DEF_FILE = defFile;
+  GUIDE_FILE = dir + "ispd18_sample.input.guide";
+  const std::string snapshotFile = "snapshotTest.bin";
+  const std::string reSnapshotFile = "snapshotTest2.bin";
+  VERBOSE = 0;
+
+  // the sample has no top-level pins, add one with figures on two layers
+  {
+    auto def = readFile(dir + "ispd18_sample.input.def");
+    const std::string noPins = "PINS 0 ;";
+    auto pos = def.find(noPins);
+    BOOST_TEST_REQUIRE((pos != std::string::npos));
+    def.replace(pos, noPins.size(),
+                "PINS 1 ;\n"
+                "- pin1 + NET net1237 + DIRECTION INPUT + USE SIGNAL\n"
+                "  + LAYER Metal2 ( -70 -140 ) ( 70 140 )\n"
+                "  + LAYER Metal3 ( -140 -70 ) ( 140 70 )\n"
+                "  + PLACED ( 84000 72000 ) N ;");
+    std::ofstream(defFile) << def;
+  }
+
+  auto textDesign = std::make_unique<frDesign>();
+  io::Parser textParser(textDesign.get());
+  textParser.readLefDef();
+  textParser.readGuide();
+  // the parser makes one frPin per DEF PIN, give the term a second pin so
+  // the multi-pin path is covered
+  {
+    auto term = textDesign->getTopBlock()->getTerms().at(0).get();
+    auto fig = static_cast<frRect*>(term->getPins()[0]->getFigs()[0].get());
+    frBox box;
+    fig->getBBox(box);
+    auto rect = std::make_unique<frRect>();
+    rect->setBBox(
+        frBox(box.left() + 400, box.bottom(), box.right() + 400, box.top()));
+    rect->setLayerNum(fig->getLayerNum());
+    auto pin = std::make_unique<frPin>();
+    pin->addPinFig(std::move(rect));
+    term->addPin(std::move(pin));
+  }
+  textParser.writeSnapshot(snapshotFile);
+
+  auto snapDesign = std::make_unique<frDesign>();
+  io::Parser snapParser(snapDesign.get());
+  BOOST_TEST_REQUIRE(snapParser.readSnapshot(snapshotFile));
+
+  auto textBlock = textDesign->getTopBlock();
+  auto snapBlock = snapDesign->getTopBlock();
+  BOOST_TEST(textBlock->getName() == snapBlock->getName());
+  BOOST_TEST(textBlock->getDBUPerUU() == snapBlock->getDBUPerUU());
+  frBox textDie, snapDie;
+  textBlock->getBoundaryBBox(textDie);
+  snapBlock->getBoundaryBBox(snapDie);
+  BOOST_TEST(textDie.left() == snapDie.left());
+  BOOST_TEST(textDie.top() == snapDie.top());
+  BOOST_TEST(textBlock->getTrackPatterns().size()
+             == snapBlock->getTrackPatterns().size());
+  BOOST_TEST(textDesign->getTech()->getVias().size()
+             == snapDesign->getTech()->getVias().size());
+
+  BOOST_TEST_REQUIRE(textBlock->getInsts().size()
+                     == snapBlock->getInsts().size());
+  for (size_t i = 0; i < textBlock->getInsts().size(); i++) {
+    auto textInst = textBlock->getInsts()[i].get();
+    auto snapInst = snapBlock->getInsts()[i].get();
+    frPoint textOrigin, snapOrigin;
+    textInst->getOrigin(textOrigin);
+    snapInst->getOrigin(snapOrigin);
+    BOOST_TEST(textInst->getName() == snapInst->getName());
+    BOOST_TEST(textInst->getId() == snapInst->getId());
+    BOOST_TEST(textInst->getRefBlock() != nullptr);
+    BOOST_TEST(textInst->getRefBlock()->getName()
+               == snapInst->getRefBlock()->getName());
+    BOOST_TEST(textOrigin.x() == snapOrigin.x());
+    BOOST_TEST(textOrigin.y() == snapOrigin.y());
+    BOOST_TEST((textInst->getOrient() == snapInst->getOrient()));
+    // instance terms take their pins from the terms of the ref block
+    auto& textInstTerms = textInst->getInstTerms();
+    auto& snapInstTerms = snapInst->getInstTerms();
+    BOOST_TEST_REQUIRE(textInstTerms.size() == snapInstTerms.size());
+    for (size_t j = 0; j < textInstTerms.size(); j++) {
+      BOOST_TEST(textInstTerms[j]->getId() == snapInstTerms[j]->getId());
+      checkSameTerm(textInstTerms[j]->getTerm(), snapInstTerms[j]->getTerm());
+    }
+  }
+
+  BOOST_TEST_REQUIRE(textBlock->getTerms().size()
+                     == snapBlock->getTerms().size());
+  for (size_t i = 0; i < textBlock->getTerms().size(); i++) {
+    checkSameTerm(textBlock->getTerms()[i].get(),
+                  snapBlock->getTerms()[i].get());
+  }
+  // both pins of pin1 and both layers of its DEF pin made it through
+  auto snapTerm = snapBlock->getTerms().at(0).get();
+  BOOST_TEST(snapTerm->getPins().size() == 2);
+  BOOST_TEST(snapTerm->getPins()[0]->getFigs().size() == 2);
+
+  BOOST_TEST_REQUIRE(textBlock->getNets().size()
+                     == snapBlock->getNets().size());
+  for (size_t i = 0; i < textBlock->getNets().size(); i++) {
+    checkSameNet(textBlock->getNets()[i].get(), snapBlock->getNets()[i].get());
+  }
+  BOOST_TEST_REQUIRE(textBlock->getSNets().size()
+                     == snapBlock->getSNets().size());
+  for (size_t i = 0; i < textBlock->getSNets().size(); i++) {
+    checkSameNet(textBlock->getSNets()[i].get(),
+                 snapBlock->getSNets()[i].get());
+  }
+
+  // guides and id counters are internal to the parser: writing the loaded
+  // design again has to reproduce the snapshot byte for byte
+  snapParser.writeSnapshot(reSnapshotFile);
+  auto snapshot = readFile(snapshotFile);
+  BOOST_TEST(!snapshot.empty());
+  BOOST_TEST((snapshot == readFile(reSnapshotFile)));
+
+  std::remove(snapshotFile.c_str());
+  std::remove(reSnapshotFile.c_str());
+  std::remove(defFile.c_str());
+}
+
+// A snapshot whose inputs changed must be rejected before the design is
+// touched so that the caller can fall back to the text path.
+BOOST_AUTO_TEST_CASE(stale_key)
+{
+  const std::string dir = std::string(TEST_TESTCASE_DIR) + "/ispd18_sample/";
+  LEF_FILE = dir + "ispd18_sample.input.lef";
+  DEF_FILE = dir + "ispd18_sample.input.def";
+  GUIDE_FILE = dir + "ispd18_sample.input.guide";
+  const std::string snapshotFile = "snapshotTest.bin";
+  VERBOSE = 0;
+
+  auto textDesign = std::make_unique<frDesign>();
+  io::Parser textParser(textDesign.get());
+  textParser.readLefDef();
+  textParser.readGuide();
+  textParser.writeSnapshot(snapshotFile);
+
+  // same file set under a different path changes the key
+  GUIDE_FILE = dir + "../ispd18_sample/ispd18_sample.input.guide";
+  auto snapDesign = std::make_unique<frDesign>();
+  io::Parser snapParser(snapDesign.get());
+  BOOST_TEST(!snapParser.readSnapshot(snapshotFile));
+  BOOST_TEST(snapDesign->getTopBlock() == nullptr);
+  BOOST_TEST(snapDesign->getRefBlocks().empty());
+
+  std::remove(snapshotFile.c_str());
+}
+
+// A snapshot whose records index past their sections must be rejected the
+// same way, even though its header and key are valid.
+BOOST_AUTO_TEST_CASE(corrupt_record)
+{
+  const std::string dir = std::string(TEST_TESTCASE_DIR) + "/ispd18_sample/";
+  LEF_FILE = dir + "ispd18_sample.input.lef";
+  DEF_FILE = dir + "ispd18_sample.input.def";
+  GUIDE_FILE = dir + "ispd18_sample.input.guide";
+  const std::string snapshotFile = "snapshotTest.bin";
+  VERBOSE = 0;
+
+  auto textDesign = std::make_unique<frDesign>();
+  io::Parser textParser(textDesign.get());
+  textParser.readLefDef();
+  textParser.readGuide();
+  textParser.writeSnapshot(snapshotFile);
+
+  // the sample has no routes and no blockages, so the file ends with the
+  // term index of the last net connection
+  {
+    std::fstream fio(snapshotFile,
+                     std::ios::in | std::ios::out | std::ios::binary);
+    BOOST_TEST_REQUIRE(fio.is_open());
+    const int32_t termIdx = 1 << 30;
+    fio.seekp(-(std::streamoff) sizeof(termIdx), std::ios::end);
+    fio.write(reinterpret_cast<const char*>(&termIdx), sizeof(termIdx));
+  }
+  auto snapDesign = std::make_unique<frDesign>();
+  io::Parser snapParser(snapDesign.get());
+  BOOST_TEST(!snapParser.readSnapshot(snapshotFile));
+  BOOST_TEST(snapDesign->getTopBlock() == nullptr);
+  BOOST_TEST(snapDesign->getRefBlocks().empty());
+
+  std::remove(snapshotFile.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END();